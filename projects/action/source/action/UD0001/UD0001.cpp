@@ -12,7 +12,12 @@ namespace solution
 
 				try
 				{
-					static Market market;
+					static Market market("UD0001");
+
+					static std::unordered_map < std::string,
+						std::unordered_map < std::string, Probability_Handles > > probability_handles; // by asset and scale
+
+					static std::unordered_map < std::string, Quotes_Handles > quotes_handles; // by asset
 
 					shared::Python python;
 
@@ -24,10 +29,19 @@ namespace solution
 
 						boost::python::object module = python.global()["run"];
 
+						auto has_updates = false;
+
 						for (const auto & asset : market.assets())
 						{
 							for (const auto & scale : market.scales())
 							{
+								if (!market.has_updates(asset, scale))
+								{
+									continue;
+								}
+
+								has_updates = true;
+
 								auto file = market.get(asset, scale, 250);
 
 								std::string message = boost::python::extract < std::string > (
@@ -35,21 +49,75 @@ namespace solution
 
 								auto object = boost::extended::serialization::json::parse(std::move(message));
 
+								auto & handles = probability_handles[asset][scale];
+
+								const auto is_prepared = handles.BO.is_prepared();
+
+								if (!is_prepared)
+								{
+									handles = Probability_Handles {
+										memory->prepare({ asset, scale, "probability", Key::BO }),
+										memory->prepare({ asset, scale, "probability", Key::BC }),
+										memory->prepare({ asset, scale, "probability", Key::SO }),
+										memory->prepare({ asset, scale, "probability", Key::SC }),
+										memory->prepare({ asset, scale, "probability", Key::WW }) };
+								}
+
 								memory->set(
-									std::make_pair(words_container_t({ asset, scale, "probability", Key::BO }), object[Key::BO].get < double > ()),
-									std::make_pair(words_container_t({ asset, scale, "probability", Key::BC }), object[Key::BC].get < double > ()),
-									std::make_pair(words_container_t({ asset, scale, "probability", Key::SO }), object[Key::SO].get < double > ()),
-									std::make_pair(words_container_t({ asset, scale, "probability", Key::SC }), object[Key::SC].get < double > ()),
-									std::make_pair(words_container_t({ asset, scale, "probability", Key::WW }), object[Key::WW].get < double > ())
-								);
+									std::make_pair(std::cref(handles.BO), object[Key::BO].get < double > ()),
+									std::make_pair(std::cref(handles.BC), object[Key::BC].get < double > ()),
+									std::make_pair(std::cref(handles.SO), object[Key::SO].get < double > ()),
+									std::make_pair(std::cref(handles.SC), object[Key::SC].get < double > ()),
+									std::make_pair(std::cref(handles.WW), object[Key::WW].get < double > ()));
+
+								if (!is_prepared) // objects exist after their first write
+								{
+									memory->set_history(handles.BO, history_capacity);
+									memory->set_history(handles.BC, history_capacity);
+									memory->set_history(handles.SO, history_capacity);
+									memory->set_history(handles.SC, history_capacity);
+									memory->set_history(handles.WW, history_capacity);
+								}
 							}
 
-							auto quotes = market.get(asset);
+							try
+							{
+								auto quotes = market.get(asset);
+
+								auto & handles = quotes_handles[asset];
+
+								if (!handles.total_ask.is_prepared())
+								{
+									handles = Quotes_Handles {
+										memory->prepare({ asset, "total", "ask" }),
+										memory->prepare({ asset, "total", "bid" }),
+										memory->prepare({ asset, "imbalance" }) };
+								}
+
+								if (!handles.is_written ||
+									quotes.total_ask != handles.last.total_ask ||
+									quotes.total_bid != handles.last.total_bid ||
+									quotes.imbalance != handles.last.imbalance)
+								{
+									memory->set(
+										std::make_pair(std::cref(handles.total_ask), quotes.total_ask),
+										std::make_pair(std::cref(handles.total_bid), quotes.total_bid),
+										std::make_pair(std::cref(handles.imbalance), quotes.imbalance));
+								}
+
+								handles.last = quotes;
+
+								handles.is_written = true;
+							}
+							catch (const std::exception & exception)
+							{
+								logger.write(Severity::error, asset + ": " + exception.what()); // other assets go on
+							}
+						}
 
-							memory->set(
-								std::make_pair(words_container_t({ asset, "total", "ask" }), quotes.total_ask),
-								std::make_pair(words_container_t({ asset, "total", "bid" }), quotes.total_bid)
-							);
+						if (!has_updates)
+						{
+							market.wait(update_timeout);
 						}
 					}
 					catch (const boost::python::error_already_set &)
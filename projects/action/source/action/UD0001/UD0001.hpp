@@ -7,7 +7,10 @@
 #  pragma once
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
+#include <chrono>
+#include <cstddef>
 #include <exception>
+#include <functional>
 #include <future>
 #include <memory>
 #include <stdexcept>
@@ -52,6 +55,33 @@ namespace solution
 				static inline const std::string WW = "WW";
 			};
 
+			struct Probability_Handles
+			{
+				View::Handle BO;
+				View::Handle BC;
+				View::Handle SO;
+				View::Handle SC;
+				View::Handle WW;
+			};
+
+			// words total, ask, bid and imbalance have to be nodes of memory, see
+			// memory/data/nodes.data of system, an asset without them is skipped
+
+			struct Quotes_Handles
+			{
+				View::Handle total_ask;
+				View::Handle total_bid;
+				View::Handle imbalance;
+
+				Market::Quotes last; // written values, the group is written again only when one changes
+
+				bool is_written = false;
+			};
+
+			const auto update_timeout = std::chrono::seconds(1);
+
+			const std::size_t history_capacity = 1024U; // latest probabilities kept for smoothing and charts
+
 			void run(std::shared_ptr < View > memory);
 
 		} // namespace UD0001
@@ -126,6 +126,20 @@ namespace solution
 					
 					Market market;
 
+					std::shared_ptr < View::Subscription > subscription;
+
+					auto subscribe_time = std::chrono::steady_clock::now();
+
+					std::unordered_map < std::string,
+						std::unordered_map < std::string, Probability_Handles > > handles; // by asset and scale
+
+					std::unordered_map < std::string,
+						std::unordered_map < std::string, Probability > > probabilities; // by asset and scale, read so far
+
+					keys_container_t keys;
+
+					auto is_initialized = false;
+
 					std::size_t sound_flag		= 0;
 					std::size_t sound_flag_last = 0;
 
@@ -141,37 +155,77 @@ namespace solution
 							}
 						}
 
-						text.clear();
+						// memory is read only for keys written since the last frame,
+						// probabilities not written yet are tried on each change
 
-						for (const auto & asset : market.assets())
+						if (!subscription && std::chrono::steady_clock::now() >= subscribe_time)
 						{
-							for (const auto & scale : market.scales())
+							subscribe_time = std::chrono::steady_clock::now() + subscribe_period;
+
+							if (Memory::try_subscribe(memory, { "probability" }, subscription))
 							{
-								while (true)
+								is_initialized = false; // keys written before the subscription are read once
+							}
+						}
+
+						if ((subscription && subscription->poll(keys)) || !is_initialized)
+						{
+							for (const auto & asset : market.assets())
+							{
+								for (const auto & scale : market.scales())
 								{
+									auto & probability_handles = handles[asset][scale];
+
+									if (is_initialized && probabilities[asset].count(scale) && !Memory::is_changed(keys,
+										probability_handles.BO, probability_handles.BC, probability_handles.SO,
+										probability_handles.SC, probability_handles.WW))
+									{
+										continue;
+									}
+
 									try
 									{
+										if (!probability_handles.BO.is_prepared())
+										{
+											probability_handles = Probability_Handles {
+												memory->prepare({ asset, scale, "probability", Key::BO }),
+												memory->prepare({ asset, scale, "probability", Key::BC }),
+												memory->prepare({ asset, scale, "probability", Key::SO }),
+												memory->prepare({ asset, scale, "probability", Key::SC }),
+												memory->prepare({ asset, scale, "probability", Key::WW }) };
+										}
+
 										memory->get(
-											std::make_pair(words_container_t({ asset, scale, "probability", Key::BO }), std::ref(probability.BO)),
-											std::make_pair(words_container_t({ asset, scale, "probability", Key::BC }), std::ref(probability.BC)),
-											std::make_pair(words_container_t({ asset, scale, "probability", Key::SO }), std::ref(probability.SO)),
-											std::make_pair(words_container_t({ asset, scale, "probability", Key::SC }), std::ref(probability.SC)),
-											std::make_pair(words_container_t({ asset, scale, "probability", Key::WW }), std::ref(probability.WW))
-										);
+											std::make_pair(std::cref(probability_handles.BO), std::ref(probability.BO)),
+											std::make_pair(std::cref(probability_handles.BC), std::ref(probability.BC)),
+											std::make_pair(std::cref(probability_handles.SO), std::ref(probability.SO)),
+											std::make_pair(std::cref(probability_handles.SC), std::ref(probability.SC)),
+											std::make_pair(std::cref(probability_handles.WW), std::ref(probability.WW)));
+
+										probabilities[asset][scale] = probability;
 									}
 									catch (...)
 									{
-										std::this_thread::sleep_for(std::chrono::seconds(5));
-
-										continue;
+										// not written yet
 									}
-
-									break;
 								}
+							}
+
+							is_initialized = true;
+						}
+
+						text.clear();
 
-								if (make_text(text, probability, asset, scale))
+						for (const auto & asset : market.assets())
+						{
+							for (const auto & scale : market.scales())
+							{
+								if (auto iterator = probabilities[asset].find(scale); iterator != std::end(probabilities[asset]))
 								{
-									++sound_flag;
+									if (make_text(text, iterator->second, asset, scale))
+									{
+										++sound_flag;
+									}
 								}
 							}
 						}
@@ -10,12 +10,12 @@
 #include <algorithm>
 #include <chrono>
 #include <exception>
+#include <functional>
 #include <iomanip>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
-#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -27,6 +27,7 @@
 
 #include "../action.hpp"
 #include "../shared/market/market.hpp"
+#include "../shared/memory/memory.hpp"
 #include "../shared/stream/stream.hpp"
 
 #include "../../../../shared/source/config/config.hpp"
@@ -43,6 +44,10 @@ namespace solution
 
 			using words_container_t = shared::Config::words_container_t;
 
+			using keys_container_t = Memory::keys_container_t;
+
+			using Severity = shared::Logger::Severity;
+
 			using stream_t = sfe::RichText;
 
 			struct Key
@@ -65,6 +70,15 @@ namespace solution
 				static inline const double threshold = 0.666;
 			};
 
+			struct Probability_Handles
+			{
+				View::Handle BO;
+				View::Handle BC;
+				View::Handle SO;
+				View::Handle SC;
+				View::Handle WW;
+			};
+
 			enum class Signal
 			{
 				B,
@@ -72,6 +86,8 @@ namespace solution
 				W
 			};
 
+			const auto subscribe_period = std::chrono::seconds(5); // between attempts while words are not in memory
+
 			void run(std::shared_ptr < View > memory);
 
 		} // namespace UD0003
@@ -20,7 +20,10 @@ namespace solution
 
 					sout.str(std::string());
 
-					if (1.0 * quotes.total_ask / std::max(quotes.total_bid, Quotes::volume_t(1)) - 1.0 > Quotes::threshold)
+					// volumes shown are of the top levels of the book, the colour
+					// follows the imbalance of the same levels
+
+					if (quotes.imbalance < -Quotes::threshold)
 					{
 						sout << std::right << std::setw(8) << std::setfill(' ') << quotes.total_ask;
 
@@ -33,7 +36,7 @@ namespace solution
 						text << sf::Color::White << " " << sout.str() << "\n";
 					}
 					else
-					if (1.0 * quotes.total_bid / std::max(quotes.total_ask, Quotes::volume_t(1)) - 1.0 > Quotes::threshold)
+					if (quotes.imbalance > Quotes::threshold)
 					{
 						sout << std::right << std::setw(8) << std::setfill(' ') << quotes.total_ask;
 
@@ -87,6 +90,20 @@ namespace solution
 					text.setPosition(size / 4, 0);
 
 					Market market;
+
+					const std::vector < words_container_t > subscription_words = { { "total" }, { "imbalance" } };
+
+					std::vector < std::shared_ptr < View::Subscription > > subscriptions(std::size(subscription_words));
+
+					auto subscribe_time = std::chrono::steady_clock::now();
+
+					std::unordered_map < std::string, Quotes_Handles > handles; // by asset
+
+					std::unordered_map < std::string, Quotes > quotes; // by asset, read so far
+
+					keys_container_t keys, subscription_keys;
+
+					auto is_initialized = false;
 					
 					while (window.isOpen())
 					{
@@ -100,32 +117,82 @@ namespace solution
 							}
 						}
 
-						text.clear();
-						
-						Quotes quotes;
+						// memory is read only for keys written since the last frame,
+						// quotes not written yet are tried on each change
 
-						for (const auto & asset : market.assets())
+						if (std::chrono::steady_clock::now() >= subscribe_time)
 						{
-							while (true)
+							subscribe_time = std::chrono::steady_clock::now() + subscribe_period;
+
+							for (std::size_t i = 0; i < std::size(subscriptions); ++i)
 							{
+								if (!subscriptions[i] && Memory::try_subscribe(memory, subscription_words[i], subscriptions[i]))
+								{
+									is_initialized = false; // keys written before the subscription are read once
+								}
+							}
+						}
+
+						keys.clear();
+
+						for (const auto & subscription : subscriptions)
+						{
+							if (subscription && subscription->poll(subscription_keys))
+							{
+								keys.insert(std::end(keys), std::begin(subscription_keys), std::end(subscription_keys));
+							}
+						}
+
+						if (!keys.empty() || !is_initialized)
+						{
+							std::sort(std::begin(keys), std::end(keys));
+
+							for (const auto & asset : market.assets())
+							{
+								auto & quotes_handles = handles[asset];
+
+								if (is_initialized && quotes.count(asset) && !Memory::is_changed(keys,
+									quotes_handles.total_ask, quotes_handles.total_bid, quotes_handles.imbalance))
+								{
+									continue;
+								}
+
 								try
 								{
+									if (!quotes_handles.total_ask.is_prepared())
+									{
+										quotes_handles = Quotes_Handles {
+											memory->prepare({ asset, "total", "ask" }),
+											memory->prepare({ asset, "total", "bid" }),
+											memory->prepare({ asset, "imbalance" }) };
+									}
+
+									Quotes asset_quotes;
+
 									memory->get(
-										std::make_pair(words_container_t({ asset, "total", "ask" }), std::ref(quotes.total_ask)),
-										std::make_pair(words_container_t({ asset, "total", "bid" }), std::ref(quotes.total_bid))
-									);
+										std::make_pair(std::cref(quotes_handles.total_ask), std::ref(asset_quotes.total_ask)),
+										std::make_pair(std::cref(quotes_handles.total_bid), std::ref(asset_quotes.total_bid)),
+										std::make_pair(std::cref(quotes_handles.imbalance), std::ref(asset_quotes.imbalance)));
+
+									quotes[asset] = asset_quotes;
 								}
 								catch (...)
 								{
-									std::this_thread::sleep_for(std::chrono::seconds(5));
-
-									continue;
+									// not written yet
 								}
-
-								break;
 							}
 
-							make_text(text, quotes, asset);
+							is_initialized = true;
+						}
+
+						text.clear();
+
+						for (const auto & asset : market.assets())
+						{
+							if (auto iterator = quotes.find(asset); iterator != std::end(quotes))
+							{
+								make_text(text, iterator->second, asset);
+							}
 						}
 
 						window.clear();
@@ -176,47 +176,91 @@ namespace solution
 
 			try
 			{
-				using shared_memory_t = boost::interprocess::managed_shared_memory;
+				get_updates(asset, scale);
 
-				using record_t = 
-					boost::interprocess::basic_string < char, std::char_traits < char >,
-					    boost::interprocess::allocator < char, shared_memory_t::segment_manager > > ;
-				
-				using record_allocator_t =
-				    boost::interprocess::allocator < record_t, shared_memory_t::segment_manager > ;
+				const auto & window = m_windows[asset + "_" + scale];
 
-				using deque_t = boost::interprocess::deque < record_t, record_allocator_t > ;
+				const auto price_scale = m_segment.candles(asset, scale).scale();
 
-				using mutex_t = boost::interprocess::interprocess_mutex;
+				auto path = directory; path /= asset + "_" + scale + Extension::txt;
+
+				std::fstream fout(path.string(), std::ios::out);
 
-				const auto shared_memory_name = "QUIK_" + asset + "_" + scale;
+				if (!fout)
+				{
+					throw market_exception("cannot open file " + path.string());
+				}
 
-				shared_memory_t shared_memory(boost::interprocess::open_only, shared_memory_name.c_str());
+				static const char delimeter = ',';
 
-				auto deque = shared_memory.find < deque_t > (boost::interprocess::unique_instance).first;
-				auto mutex = shared_memory.find < mutex_t > (boost::interprocess::unique_instance).first;
-				
-				auto path = directory; path /= asset + "_" + scale + Extension::txt;
+				fout << "date,time,open,high,low,close,v" << '\n';
 
+				for (auto record = std::prev(std::end(window), std::min(quantity, window.size())); record != std::end(window); ++record)
 				{
-					boost::interprocess::scoped_lock < mutex_t > lock(*mutex);
+					fout <<
+						std::setfill('0') << std::setw(8) << record->date << delimeter <<
+						std::setfill('0') << std::setw(6) << record->time << delimeter <<
+						Price::to_string(record->price_open, price_scale) << delimeter <<
+						Price::to_string(record->price_high, price_scale) << delimeter <<
+						Price::to_string(record->price_low, price_scale) << delimeter <<
+						Price::to_string(record->price_close, price_scale) << delimeter <<
+						record->volume << '\n';
+				}
+
+				return path;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
 
-					std::fstream fout(path.string(), std::ios::out);
+		Market::candles_container_t Market::get_updates(const std::string & asset, const std::string & scale) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				update();
+
+				auto & candles = m_segment.candles(asset, scale);
+
+				auto updates = candles.get(m_segment.cursor(m_consumer, asset, scale), candles.capacity());
+
+				auto & window = m_windows[asset + "_" + scale];
 
-					if (!fout)
+				if (!updates.empty())
+				{
+					while (!window.empty() && window.back().index >= updates.front().index)
 					{
-						throw market_exception("cannot open file " + path.string());
+						window.pop_back();
 					}
 
-					fout << "date,time,open,high,low,close,v" << std::endl;
+					window.insert(std::end(window), std::begin(updates), std::end(updates));
 
-					for (const auto & record : *deque)
+					while (window.size() > candles.capacity())
 					{
-						fout << record << std::endl;
+						window.pop_front();
 					}
 				}
 
-				return path;
+				return updates;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		bool Market::has_updates(const std::string & asset, const std::string & scale) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				update();
+
+				return m_segment.candles(asset, scale).has_updates(m_segment.cursor(m_consumer, asset, scale));
 			}
 			catch (const std::exception & exception)
 			{
@@ -298,29 +342,140 @@ namespace solution
 
 			try
 			{
-				using shared_memory_t = boost::interprocess::managed_shared_memory;
+				update();
+
+				Book::Snapshot snapshot;
 
-				using mutex_t = boost::interprocess::interprocess_mutex;
+				Book::Features features;
 
-				const auto shared_memory_name = "QUIK_" + asset + "_quotes";
+				m_segment.book(asset).get(snapshot, features);
 
-				shared_memory_t shared_memory(boost::interprocess::open_only, shared_memory_name.c_str());
+				Quotes quotes;
 
-				auto mutex = shared_memory.find < mutex_t > (boost::interprocess::unique_instance).first;
+				quotes.total_ask = snapshot.total_ask;
+				quotes.total_bid = snapshot.total_bid;
 
-				auto total_ask = shared_memory.find < Quotes::volume_t > (Quotes::Name::total_ask.c_str()).first;
-				auto total_bid = shared_memory.find < Quotes::volume_t > (Quotes::Name::total_bid.c_str()).first;
+				static_assert(Book::band_levels[Book::bands - 1U] == Book::depth, "imbalance does not cover levels of totals");
 
-				Quotes quotes;
+				quotes.imbalance = features.imbalance[Book::bands - 1U];
+
+				return quotes;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		Market::Book::Snapshot Market::get_book(const std::string & asset) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				update();
+
+				const auto & book = m_segment.book(asset);
+
+				auto & snapshot = m_books[asset];
+
+				if (snapshot.sequence == 0 || !book.update(snapshot))
+				{
+					snapshot = book.get();
+				}
+
+				return snapshot;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::update() const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				m_segment.update();
 
+				if (const auto generation = m_segment.generation(); generation != m_generation)
 				{
-					boost::interprocess::scoped_lock < mutex_t > (*mutex);
+					m_windows.clear();
+					m_versions.clear();
+					m_books.clear();
 
-					quotes.total_ask = *total_ask;
-					quotes.total_bid = *total_bid;
+					m_generation = generation;
 				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
 
-				return quotes;
+		bool Market::wait(const std::string & asset, const std::string & scale, std::chrono::milliseconds timeout) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				update();
+
+				return wait(asset + "_" + scale, m_segment.candles(asset, scale).event(), timeout);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		bool Market::wait(const std::string & asset, std::chrono::milliseconds timeout) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				update();
+
+				return wait(asset + "_" + shared::market::Directory::Name::quotes, m_segment.book(asset).event(), timeout);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		bool Market::wait(std::chrono::milliseconds timeout) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				update();
+
+				return wait(shared::market::Directory::Name::segment, m_segment.event(), timeout);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		bool Market::wait(const std::string & key, const Event & event, std::chrono::milliseconds timeout) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				auto & version = m_versions[key];
+
+				const auto result = event.wait(version, timeout);
+
+				version = event.version();
+
+				return result;
 			}
 			catch (const std::exception & exception)
 			{
@@ -12,6 +12,7 @@
 #include <chrono>
 #include <cstdint>
 #include <ctime>
+#include <deque>
 #include <exception>
 #include <fstream>
 #include <iomanip>
@@ -20,24 +21,23 @@
 #include <string>
 #include <sstream>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #define BOOST_PYTHON_STATIC_LIB
 
 #include <boost/filesystem.hpp>
-#include <boost/interprocess/allocators/allocator.hpp>
-#include <boost/interprocess/containers/deque.hpp>
-#include <boost/interprocess/containers/string.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
-#include <boost/interprocess/sync/interprocess_mutex.hpp>
-#include <boost/interprocess/sync/named_mutex.hpp>
-#include <boost/interprocess/sync/scoped_lock.hpp>
 #include <boost/interprocess/managed_windows_shared_memory.hpp>
 #include <boost/python.hpp>
 
 #include "quotes/quotes.hpp"
 
 #include "../../../../../shared/source/logger/logger.hpp"
+#include "../../../../../shared/source/market/candles/candles.hpp"
+#include "../../../../../shared/source/market/event/event.hpp"
+#include "../../../../../shared/source/market/price/price.hpp"
+#include "../../../../../shared/source/market/segment/segment.hpp"
 #include "../../../../../shared/source/python/python.hpp"
 
 namespace solution
@@ -69,6 +69,18 @@ namespace solution
 
 			using Quotes = market::Quotes;
 
+			using Candle = shared::market::Candle;
+
+			using Candles = shared::market::Candles;
+
+			using Price = shared::market::Price;
+
+			using Event = shared::market::Event;
+
+			using Book = shared::market::Book;
+
+			using Segment = shared::market::Segment;
+
 		private:
 
 			using time_point_t = std::chrono::time_point < clock_t > ;
@@ -79,6 +91,17 @@ namespace solution
 
 			using scales_container_t = std::vector < std::string > ;
 
+			using candles_container_t = Candles::candles_container_t;
+
+			using windows_container_t = 
+				std::unordered_map < std::string, std::deque < Candle > > ;
+
+			using versions_container_t = 
+				std::unordered_map < std::string, Event::version_t > ;
+
+			using books_container_t = 
+				std::unordered_map < std::string, Book::Snapshot > ;
+
 		private:
 
 			struct Extension
@@ -119,7 +142,12 @@ namespace solution
 
 		public:
 
-			Market()
+			Market() : Market(default_consumer)
+			{}
+
+			template < typename C, typename Enable =
+				std::enable_if_t < std::is_convertible_v < C, std::string > > >
+			explicit Market(C && consumer) : m_consumer(std::forward < C > (consumer))
 			{
 				initialize();
 			}
@@ -157,11 +185,33 @@ namespace solution
 			path_t get(const std::string & asset, const std::string & scale, time_point_t first, time_point_t last) const;
 			
 			path_t get(const std::string & asset, const std::string & scale, std::size_t quantity) const;
+
+			candles_container_t get_updates(const std::string & asset, const std::string & scale) const;
+
+			bool has_updates(const std::string & asset, const std::string & scale) const;
 			
 			path_t get(const std::string & asset, const std::string & scale) const;
 
 			Quotes get(const std::string & asset) const;
 
+			Book::Snapshot get_book(const std::string & asset) const;
+
+		public:
+
+			bool wait(const std::string & asset, const std::string & scale, std::chrono::milliseconds timeout) const;
+
+			bool wait(const std::string & asset, std::chrono::milliseconds timeout) const;
+
+			bool wait(std::chrono::milliseconds timeout) const; // any update of any asset
+
+		private:
+
+			bool wait(const std::string & key, const Event & event, std::chrono::milliseconds timeout) const;
+
+		private:
+
+			void update() const; // drops caches of a remapped segment
+
 		private:
 
 			date_t make_date(time_point_t time_point) const;
@@ -170,11 +220,31 @@ namespace solution
 
 			static inline const path_t directory = "market/candles";
 
+			static inline const std::string default_consumer = "action";
+
+		private:
+
+			const std::string m_consumer;
+
 		private:
 
 			assets_container_t m_assets;
 
 			scales_container_t m_scales;
+
+		private:
+
+			mutable Segment m_segment;
+
+			mutable shared::market::Directory::generation_t m_generation = 0;
+
+		private:
+
+			mutable windows_container_t m_windows;
+
+			mutable versions_container_t m_versions;
+
+			mutable books_container_t m_books;
 		};
 
 	} // namespace action
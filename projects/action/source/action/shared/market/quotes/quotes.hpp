@@ -23,16 +23,12 @@ namespace solution
 			{
 				using volume_t = std::uint64_t;
 
-				struct Name
-				{
-					static inline const std::string total_ask = "total_ask";
-					static inline const std::string total_bid = "total_bid";
-				};
+				static inline const double threshold = 0.05; // of imbalance
 
-				static inline const double threshold = 0.1;
-
-				volume_t total_ask;
+				volume_t total_ask; // volume of the top Book::depth levels, not of the whole book
 				volume_t total_bid;
+
+				double imbalance; // (bid - ask) / (bid + ask) volume of the same levels as the totals
 			};
 
 		} // namespace market
@@ -0,0 +1,30 @@
+#include "memory.hpp"
+
+namespace solution
+{
+	namespace action
+	{
+		using Severity = shared::Logger::Severity;
+
+		bool Memory::try_subscribe(std::shared_ptr < View > memory, const words_container_t & words,
+			std::shared_ptr < View::Subscription > & subscription)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				subscription = memory->subscribe(words);
+
+				return true;
+			}
+			catch (const std::exception & exception)
+			{
+				logger.write(Severity::error, exception.what());
+
+				return false;
+			}
+		}
+
+	} // namespace action
+
+} // namespace solution
@@ -0,0 +1,89 @@
+#ifndef SOLUTION_ACTION_MEMORY_HPP
+#define SOLUTION_ACTION_MEMORY_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "../../../../../shared/source/config/config.hpp"
+#include "../../../../../shared/source/logger/logger.hpp"
+#include "../../../../../shared/source/memory/view/view_base.hpp"
+
+namespace solution
+{
+	namespace action
+	{
+		class memory_exception : public std::exception
+		{
+		public:
+
+			explicit memory_exception(const std::string & message) noexcept :
+				std::exception(message.c_str())
+			{}
+
+			explicit memory_exception(const char * const message) noexcept :
+				std::exception(message)
+			{}
+
+			~memory_exception() noexcept = default;
+		};
+
+		// helpers of actions that read memory only for keys written since
+		// their last poll of a subscription
+
+		class Memory
+		{
+		public:
+
+			using View = shared::memory::View_Base;
+
+			using words_container_t = shared::Config::words_container_t;
+
+			using keys_container_t = View::Subscription::keys_container_t;
+
+		public:
+
+			// subscribe throws while a word is not a node of memory yet, the
+			// action goes on without the subscription and tries again later
+
+			static bool try_subscribe(std::shared_ptr < View > memory, const words_container_t & words,
+				std::shared_ptr < View::Subscription > & subscription);
+
+			// keys are sorted, as polled from a subscription
+
+			template < typename ... Handles >
+			static bool is_changed(const keys_container_t & keys, const Handles & ... handles)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto is_written = [&keys](const View::Handle & handle)
+					{
+						return std::binary_search(std::begin(keys), std::end(keys), handle.ids());
+					};
+
+					return (is_written(handles) || ...);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < memory_exception > (logger, exception);
+				}
+			}
+		};
+
+	} // namespace action
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_ACTION_MEMORY_HPP
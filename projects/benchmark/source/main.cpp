@@ -0,0 +1,642 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+
+#include "../../shared/source/logger/logger.hpp"
+#include "../../shared/source/market/candles/candles.hpp"
+#include "../../shared/source/memory/view/view_base.hpp"
+
+#include "../../system/source/memory/memory.hpp"
+#include "../../system/source/memory/view/direct_view.hpp"
+#include "../../system/source/memory/view/view.hpp"
+
+using Logger = solution::shared::Logger;
+
+using Memory = solution::system::Memory;
+
+using View_Base = solution::shared::memory::View_Base;
+
+using View = solution::system::memory::View;
+
+using Direct_View = solution::system::memory::Direct_View;
+
+using words_container_t = View_Base::words_container_t;
+
+using Object = View_Base::Object;
+
+using data_t = View_Base::data_t;
+
+using counter_t = std::uint64_t;
+
+using Candles = solution::shared::market::Candles;
+
+// directory of its own for the real memory of the system, since its data
+// paths are relative, nodes are appended to the empty list of nodes.data
+
+class Sandbox
+{
+public:
+
+	using path_t = boost::filesystem::path;
+
+public:
+
+	static inline const path_t data_directory = "memory/data"; // as Memory::Data::File sees it
+
+	static inline const path_t nodes_data = "memory/data/nodes.data";
+
+public:
+
+	Sandbox() : m_directory(boost::filesystem::temp_directory_path() /
+		boost::filesystem::unique_path("benchmark-%%%%-%%%%-%%%%")), m_initial_directory(boost::filesystem::current_path())
+	{
+		boost::filesystem::create_directories(m_directory / data_directory);
+
+		std::ofstream fout((m_directory / nodes_data).string());
+
+		fout << "[]";
+
+		if (!fout.flush())
+		{
+			throw std::runtime_error("cannot write file " + (m_directory / nodes_data).string());
+		}
+
+		boost::filesystem::current_path(m_directory);
+	}
+
+	~Sandbox() noexcept
+	{
+		boost::system::error_code error;
+
+		boost::filesystem::current_path(m_initial_directory, error);
+
+		boost::filesystem::remove_all(m_directory, error);
+	}
+
+private:
+
+	Sandbox			  (const Sandbox &) = delete;
+	Sandbox & operator=(const Sandbox &) = delete;
+
+private:
+
+	const path_t m_directory;
+
+	const path_t m_initial_directory;
+};
+
+// previous path of values: formatted into text on set and parsed back on get
+
+template < typename V, typename T >
+void set_text(const V & view, const words_container_t & words, T value)
+{
+	std::stringstream sout;
+
+	sout << value;
+
+	view.set(std::make_pair(words, sout.str()));
+}
+
+template < typename V, typename T >
+void get_text(const V & view, const words_container_t & words, T & value)
+{
+	std::string text;
+
+	view.get(std::make_pair(words, std::ref(text)));
+
+	std::stringstream sin(text);
+
+	sin >> value;
+}
+
+// calls f(probability, total, probability_result, total_result) on each
+// iteration, mismatches count values that did not survive the round trip
+
+template < typename F >
+double measure(std::size_t iterations, counter_t & mismatches, F && f) // nanoseconds per iteration
+{
+	const auto begin = std::chrono::steady_clock::now();
+
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		const auto probability = (static_cast < double > (i % 1000U) + 0.123456789) / 1000.0;
+		const auto total       = static_cast < std::uint64_t > (i) * 1000003ULL;
+
+		double        probability_result = 0.0;
+		std::uint64_t total_result       = 0;
+
+		f(probability, total, probability_result, total_result);
+
+		mismatches += (probability_result != probability || total_result != total ? 1U : 0U);
+	}
+
+	const auto end = std::chrono::steady_clock::now();
+
+	return static_cast < double > (std::chrono::duration_cast < std::chrono::nanoseconds > (end - begin).count()) /
+		static_cast < double > (iterations);
+}
+
+void print(const std::string & name, double duration, counter_t mismatches)
+{
+	std::cout << name << ": " << duration << " ns per iteration, " << mismatches << " mismatches" << std::endl;
+}
+
+const words_container_t probability_words = { "SBER", "M1", "probability", "BO" };
+const words_container_t total_words       = { "SBER", "total", "ask" };
+
+// set and get of a probability and a volume total, as actions do, through
+// text, through typed values, through typed values with words interned in
+// advance and through prepared handles, text is measured once, since it is
+// dominated by formatting
+
+template < typename V >
+void run(const std::string & name, std::shared_ptr < Memory > memory, std::size_t iterations, bool has_text)
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		V view(memory);
+
+		const auto probability_ids = view.intern(probability_words);
+		const auto total_ids       = view.intern(total_words);
+
+		const auto probability_handle = view.prepare(probability_words);
+		const auto total_handle       = view.prepare(total_words);
+
+		if (has_text)
+		{
+			counter_t mismatches = 0;
+
+			const auto text = measure(iterations, mismatches, [&](auto probability, auto total, auto & probability_result, auto & total_result)
+			{
+				set_text(view, probability_words, probability);
+				set_text(view, total_words, total);
+
+				get_text(view, probability_words, probability_result);
+				get_text(view, total_words, total_result);
+			});
+
+			print(name + " text", text, mismatches);
+		}
+
+		counter_t typed_mismatches = 0, interned_mismatches = 0, prepared_mismatches = 0;
+
+		const auto typed = measure(iterations, typed_mismatches, [&](auto probability, auto total, auto & probability_result, auto & total_result)
+		{
+			view.set(
+				std::make_pair(probability_words, probability),
+				std::make_pair(total_words, total));
+
+			view.get(
+				std::make_pair(probability_words, std::ref(probability_result)),
+				std::make_pair(total_words, std::ref(total_result)));
+		});
+
+		const auto interned = measure(iterations, interned_mismatches, [&](auto probability, auto total, auto & probability_result, auto & total_result)
+		{
+			view.set(
+				std::make_pair(probability_ids, probability),
+				std::make_pair(total_ids, total));
+
+			view.get(
+				std::make_pair(probability_ids, std::ref(probability_result)),
+				std::make_pair(total_ids, std::ref(total_result)));
+		});
+
+		const auto prepared = measure(iterations, prepared_mismatches, [&](auto probability, auto total, auto & probability_result, auto & total_result)
+		{
+			view.set(probability_handle, probability);
+			view.set(total_handle, total);
+
+			view.get(probability_handle, probability_result);
+			view.get(total_handle, total_result);
+		});
+
+		print(name + " typed",    typed,    typed_mismatches);
+		print(name + " interned", interned, interned_mismatches);
+		print(name + " prepared", prepared, prepared_mismatches);
+	}
+	catch (const std::exception & exception)
+	{
+		solution::shared::catch_handler < std::runtime_error > (logger, exception);
+	}
+}
+
+// lookup of values by interned ids among many objects sharing their words,
+// as find_intersection sees it: four-word keys of 400 assets, each asset
+// node holds 80 objects and each of the other nodes holds thousands
+
+void run_lookup(std::shared_ptr < Memory > memory, std::size_t iterations)
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		const words_container_t scales = { "M1", "M5", "M15", "H1", "D1" };
+		const words_container_t kinds  = { "probability", "total", "ask", "bid" };
+		const words_container_t sides  = { "BO", "BC", "SO", "SC" };
+
+		words_container_t assets;
+
+		for (std::size_t i = 0; i < 400U; ++i)
+		{
+			assets.push_back("ASSET" + std::to_string(i));
+		}
+
+		for (const auto & words : { assets, scales, kinds, sides })
+		{
+			for (const auto & word : words)
+			{
+				memory->append_node(word);
+			}
+		}
+
+		Direct_View view(memory);
+
+		std::vector < View_Base::ids_container_t > keys;
+
+		for (const auto & asset : assets)
+		{
+			for (const auto & scale : scales)
+			{
+				for (const auto & kind : kinds)
+				{
+					for (const auto & side : sides)
+					{
+						keys.push_back(view.intern(words_container_t({ asset, scale, kind, side })));
+
+						view.set(std::make_pair(keys.back(), static_cast < double > (std::size(keys))));
+					}
+				}
+			}
+		}
+
+		counter_t mismatches = 0;
+
+		const auto begin = std::chrono::steady_clock::now();
+
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			const auto index = (i * 7919U) % std::size(keys); // not in the order of creation
+
+			double value = 0.0;
+
+			view.get(std::make_pair(keys[index], std::ref(value)));
+
+			mismatches += (value != static_cast < double > (index + 1U) ? 1U : 0U);
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+
+		print("lookup of " + std::to_string(std::size(keys)), static_cast < double > (
+			std::chrono::duration_cast < std::chrono::nanoseconds > (end - begin).count()) / static_cast < double > (iterations), mismatches);
+	}
+	catch (const std::exception & exception)
+	{
+		solution::shared::catch_handler < std::runtime_error > (logger, exception);
+	}
+}
+
+// value guarded by a reader-writer lock, as objects kept it before versions
+
+class Locked
+{
+public:
+
+	explicit Locked(data_t data) : m_data(std::move(data))
+	{}
+
+	~Locked() noexcept = default;
+
+public:
+
+	data_t data() const
+	{
+		std::shared_lock < std::shared_mutex > lock(m_mutex);
+
+		return m_data;
+	}
+
+	void update(data_t data)
+	{
+		std::scoped_lock < std::shared_mutex > lock(m_mutex);
+
+		m_data = std::move(data);
+	}
+
+private:
+
+	data_t m_data;
+
+private:
+
+	mutable std::shared_mutex m_mutex;
+};
+
+// one writer updates a value while readers copy it as fast as they can, as
+// UD0001 publishes probabilities while charts of UD0003 and UD0004 poll them
+
+template < typename O >
+void run_contention(const std::string & name, std::size_t iterations, std::size_t readers)
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		O object(data_t(0.0));
+
+		std::atomic < bool > is_stopped { false };
+
+		std::atomic < counter_t > reads { 0 };
+
+		std::vector < std::thread > threads;
+
+		for (std::size_t i = 0; i < readers; ++i)
+		{
+			threads.emplace_back([&object, &is_stopped, &reads]()
+			{
+				counter_t count = 0;
+
+				for (; !is_stopped.load(std::memory_order_acquire); ++count)
+				{
+					object.data();
+				}
+
+				reads.fetch_add(count);
+			});
+		}
+
+		const auto begin = std::chrono::steady_clock::now();
+
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			object.update(data_t(static_cast < double > (i)));
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+
+		is_stopped.store(true, std::memory_order_release);
+
+		for (auto & thread : threads)
+		{
+			thread.join();
+		}
+
+		const auto duration = static_cast < double > (std::chrono::duration_cast < std::chrono::nanoseconds > (end - begin).count());
+
+		std::cout << name << ": writer " << duration / static_cast < double > (iterations) << " ns per update, " << readers << 
+			" readers " << static_cast < double > (reads.load()) * 1000.0 / duration << " reads per us" << std::endl;
+	}
+	catch (const std::exception & exception)
+	{
+		solution::shared::catch_handler < std::runtime_error > (logger, exception);
+	}
+}
+
+// ring of candles in process memory, read as Market of actions and of the
+// trader reads the segment of Source: a window of candles and the price,
+// each guarded by the seqlock of the ring
+
+class Ring
+{
+public:
+
+	explicit Ring(std::size_t capacity) : m_slots(capacity), m_candles(&m_header, m_slots.data(), capacity)
+	{}
+
+	~Ring() noexcept = default;
+
+private:
+
+	Ring			(const Ring &) = delete;
+	Ring & operator=(const Ring &) = delete;
+
+public:
+
+	void publish(const Candles::Candle & candle)
+	{
+		m_candles.publish(&candle, &candle + 1, candle.price_close);
+	}
+
+	auto read(std::size_t quantity) const
+	{
+		return std::make_pair(m_candles.get(quantity).size(), m_candles.price());
+	}
+
+private:
+
+	Candles::Header m_header;
+
+	Candles::candles_container_t m_slots;
+
+	Candles m_candles;
+};
+
+// the same ring guarded as before the seqlock, by an interprocess mutex held
+// around each publication and each copy, the seqlock is then never contended
+
+class Locked_Ring : public Ring
+{
+public:
+
+	using Ring::Ring;
+
+public:
+
+	void publish(const Candles::Candle & candle)
+	{
+		boost::interprocess::scoped_lock < boost::interprocess::interprocess_mutex > lock(m_mutex);
+
+		Ring::publish(candle);
+	}
+
+	auto read(std::size_t quantity) const
+	{
+		boost::interprocess::scoped_lock < boost::interprocess::interprocess_mutex > lock(m_mutex);
+
+		return Ring::read(quantity);
+	}
+
+private:
+
+	mutable boost::interprocess::interprocess_mutex m_mutex;
+};
+
+const std::size_t capacity = 1000U;
+
+const std::size_t quantity = 100U; // candles of each read
+
+const std::chrono::microseconds publication_period(5);
+
+// Source publishes a candle and the price once per publication period while
+// charts and the trader copy the last candles and the price as fast as they
+// can, the writer is timed inside publications only, since the period keeps
+// readers from starving as an unpaced writer would
+
+template < typename R >
+void run_candles(const std::string & name, std::size_t iterations, std::size_t readers)
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		R ring(capacity);
+
+		std::atomic < bool > is_stopped { false };
+
+		std::atomic < std::size_t > started { 0 };
+
+		std::atomic < counter_t > reads { 0 };
+
+		std::vector < std::thread > threads;
+
+		for (std::size_t i = 0; i < readers; ++i)
+		{
+			threads.emplace_back([&ring, &is_stopped, &started, &reads]()
+			{
+				started.fetch_add(1);
+
+				counter_t count = 0;
+
+				for (; !is_stopped.load(std::memory_order_acquire); ++count)
+				{
+					ring.read(quantity);
+				}
+
+				reads.fetch_add(count);
+			});
+		}
+
+		while (started.load() != readers)
+		{
+			std::this_thread::yield();
+		}
+
+		Candles::Candle candle;
+
+		std::chrono::nanoseconds publications(0);
+
+		const auto begin = std::chrono::steady_clock::now();
+
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			candle.index = i / 10U + 1U; // the last candle is updated between new ones
+
+			candle.price_close = static_cast < Candles::price_t > (i);
+
+			const auto publication_begin = std::chrono::steady_clock::now();
+
+			ring.publish(candle);
+
+			const auto publication_end = std::chrono::steady_clock::now();
+
+			publications += publication_end - publication_begin;
+
+			while (std::chrono::steady_clock::now() - publication_begin < publication_period);
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+
+		is_stopped.store(true, std::memory_order_release);
+
+		for (auto & thread : threads)
+		{
+			thread.join();
+		}
+
+		const auto duration = static_cast < double > (std::chrono::duration_cast < std::chrono::nanoseconds > (end - begin).count());
+
+		std::cout << name << ": writer " << static_cast < double > (publications.count()) / static_cast < double > (iterations) << 
+			" ns per publication, " << readers << " readers " << static_cast < double > (reads.load()) * 1000.0 / duration << 
+			" reads per us" << std::endl;
+	}
+	catch (const std::exception & exception)
+	{
+		solution::shared::catch_handler < std::runtime_error > (logger, exception);
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		const auto iterations = (argc > 1 ? static_cast < std::size_t > (std::stoull(argv[1])) : 1000000U);
+
+		const auto readers = (argc > 2 ? static_cast < std::size_t > (std::stoull(argv[2])) : 
+			std::max(static_cast < std::size_t > (std::thread::hardware_concurrency()), std::size_t(2U)) - 1U);
+
+		if (iterations == 0 || readers == 0)
+		{
+			std::cout << "usage: benchmark [<iterations> [<readers>]]" << std::endl;
+
+			return EXIT_FAILURE;
+		}
+
+		std::cout << "iterations: " << iterations << std::endl;
+
+		{
+			Sandbox sandbox;
+
+			auto memory = std::make_shared < Memory > ();
+
+			for (const auto & word : { "SBER", "M1", "probability", "BO", "total", "ask" })
+			{
+				memory->append_node(word);
+			}
+
+			run < View > ("virtual", memory, iterations, true);
+
+			run < Direct_View > ("static", memory, iterations, false);
+		}
+
+		{
+			Sandbox sandbox;
+
+			run_lookup(std::make_shared < Memory > (), iterations);
+		}
+
+		run_contention < Locked > ("locked", iterations, readers);
+
+		run_contention < Object > ("versioned", iterations, readers);
+
+		run_candles < Locked_Ring > ("candles locked", iterations, readers);
+
+		run_candles < Ring > ("candles seqlock", iterations, readers);
+
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception & exception)
+	{
+		logger.write(Logger::Severity::fatal, exception.what());
+
+		return EXIT_FAILURE;
+	}
+	catch (...)
+	{
+		logger.write(Logger::Severity::fatal, "unknown exception");
+
+		return EXIT_FAILURE;
+	}
+}
\ No newline at end of file
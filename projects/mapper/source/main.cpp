@@ -39,13 +39,22 @@ auto load_m1_candles(const Market & market, const std::string & asset)
 			throw std::runtime_error("cannot open file " + file.string());
 		}
 
-		std::vector < Candle > m1_candles;
+		std::vector < std::string > lines;
+
+		Candle::scale_t scale = 0;
+
+		for (std::string s; std::getline(fin, s); )
+		{
+			scale = std::max(scale, Mapper::scale(s));
 
-		std::string s;
+			lines.push_back(std::move(s));
+		}
+
+		std::vector < Candle > m1_candles;
 
-		while (std::getline(fin, s))
+		for (const auto & line : lines)
 		{
-			m1_candles.push_back(Mapper::parse(s));
+			m1_candles.push_back(Mapper::parse(line, scale));
 		}
 
 		return m1_candles;
@@ -76,10 +85,10 @@ auto save_m5_candles(const path_t & path, const std::vector < Candle > & m5_cand
 			fout <<
 				m5_candle.date		  << separator <<
 				m5_candle.time		  << separator <<
-				m5_candle.price_open  << separator <<
-				m5_candle.price_high  << separator <<
-				m5_candle.price_low   << separator <<
-				m5_candle.price_close << separator <<
+				Mapper::Price::to_string(m5_candle.price_open,  m5_candle.scale) << separator <<
+				Mapper::Price::to_string(m5_candle.price_high,  m5_candle.scale) << separator <<
+				Mapper::Price::to_string(m5_candle.price_low,   m5_candle.scale) << separator <<
+				Mapper::Price::to_string(m5_candle.price_close, m5_candle.scale) << separator <<
 				m5_candle.volume	  << std::endl;
 		}
 
@@ -131,6 +140,8 @@ auto combine_m1_to_m5_candles(const std::vector < Candle > & m1_candles, std::si
 
 			m5_candle.volume = 0;
 
+			m5_candle.scale = m1_candles.at(j).scale;
+
 			std::for_each(std::begin(m1_candles) + j, std::begin(m1_candles) + j + 5,
 				[&m5_candle](const auto & m1_candle)
 			{
@@ -34,30 +34,92 @@ namespace solution
 			}
 		}
 
-		Mapper::Candle Mapper::parse(const std::string & s)
+		Mapper::Candle Mapper::parse(const std::string & s, Candle::scale_t scale)
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				Candle_Parser < std::string::const_iterator > parser;
-
-				auto first = std::begin(s);
-				auto last  = std::end(s);
+				const auto fields = split(s);
 
 				Candle candle;
 
-				auto result = boost::spirit::qi::phrase_parse(
-					first, last, parser, boost::spirit::qi::blank, candle);
+				auto parse_integer = [&s](std::string_view field, auto & value)
+				{
+					if (std::from_chars(field.data(), field.data() + field.size(), value).ec != std::errc())
+					{
+						throw mapper_exception("cannot parse line " + s);
+					}
+				};
+
+				parse_integer(fields[0], candle.date);
+				parse_integer(fields[1], candle.time);
+
+				candle.price_open  = Price::parse(fields[2], scale);
+				candle.price_high  = Price::parse(fields[3], scale);
+				candle.price_low   = Price::parse(fields[4], scale);
+				candle.price_close = Price::parse(fields[5], scale);
+
+				parse_integer(fields[6], candle.volume);
 
-				if (result)
+				candle.scale = scale;
+
+				return candle;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < mapper_exception > (logger, exception);
+			}
+		}
+
+		Mapper::Candle::scale_t Mapper::scale(const std::string & s)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				const auto fields = split(s);
+
+				return std::max({
+					Price::decimals(fields[2]), Price::decimals(fields[3]),
+					Price::decimals(fields[4]), Price::decimals(fields[5]) });
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < mapper_exception > (logger, exception);
+			}
+		}
+
+		Mapper::fields_container_t Mapper::split(const std::string & s)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				static const auto separator = ',';
+
+				fields_container_t fields;
+
+				for (std::string_view view(s); ; )
 				{
-					return candle;
+					const auto position = view.find(separator);
+
+					fields.push_back(view.substr(0, position));
+
+					if (position == std::string_view::npos)
+					{
+						break;
+					}
+
+					view.remove_prefix(position + 1);
 				}
-				else
+
+				if (fields.size() != 7U)
 				{
 					throw mapper_exception("cannot parse line " + s);
 				}
+
+				return fields;
 			}
 			catch (const std::exception & exception)
 			{
@@ -78,11 +140,20 @@ namespace solution
 					throw mapper_exception("cannot open file " + m_path.string());
 				}
 
-				std::string s;
+				std::vector < std::string > lines;
+
+				Candle::scale_t scale = 0;
+
+				for (std::string s; std::getline(fin, s); )
+				{
+					scale = std::max(scale, Mapper::scale(s));
+
+					lines.push_back(std::move(s));
+				}
 
-				while (std::getline(fin, s))
+				for (const auto & line : lines)
 				{
-					m_data.push_back(std::make_pair(parse(s), std::string()));
+					m_data.push_back(std::make_pair(parse(line, scale), std::string()));
 				}
 
 				std::reverse(std::begin(m_data), std::end(m_data));
@@ -125,15 +196,15 @@ namespace solution
 							last_extremum  = result.first;
 						}
 
-						if ((((max_price - min_price) / min_price < min_price_change) ||
+						if ((((max_price - min_price) < min_price_change * min_price) ||
 							(result.first == last) ||
 							(result.second == last) ||
 							((last_extremum != last) &&
-							((max_price - min_price) / min_price > min_price_change) &&
-								(abs(last_extremum->first.price_close - last->first.price_close) < max_price_rollback *
-									abs(first_extremum->first.price_close - last_extremum->first.price_close)))) &&
-									(abs(last_extremum->first.price_close - last->first.price_close) /
-										std::min(last_extremum->first.price_close, last->first.price_close) < min_price_change))
+							((max_price - min_price) > min_price_change * min_price) &&
+								(std::abs(last_extremum->first.price_close - last->first.price_close) < max_price_rollback *
+									std::abs(first_extremum->first.price_close - last_extremum->first.price_close)))) &&
+									(std::abs(last_extremum->first.price_close - last->first.price_close) <
+										min_price_change * std::min(last_extremum->first.price_close, last->first.price_close)))
 						{
 							continue;
 						}
@@ -198,10 +269,10 @@ namespace solution
 					fout <<
 						record.first.date		 << separator <<
 						record.first.time		 << separator <<
-						record.first.price_open  << separator <<
-						record.first.price_high  << separator <<
-						record.first.price_low   << separator <<
-						record.first.price_close << separator <<
+						Price::to_string(record.first.price_open,  record.first.scale) << separator <<
+						Price::to_string(record.first.price_high,  record.first.scale) << separator <<
+						Price::to_string(record.first.price_low,   record.first.scale) << separator <<
+						Price::to_string(record.first.price_close, record.first.scale) << separator <<
 						record.first.volume		 << separator <<
 						record.second			 << std::endl;
 				}
@@ -8,26 +8,22 @@
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
 #include <algorithm>
+#include <charconv>
 #include <cmath>
 #include <cstdint>
 #include <exception>
 #include <iterator>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
-#include <boost/config/warning_disable.hpp>
 #include <boost/filesystem.hpp>
-#include <boost/fusion/include/adapt_struct.hpp>
-#include <boost/fusion/include/io.hpp>
-#include <boost/spirit/include/qi.hpp>
-#include <boost/spirit/include/phoenix_core.hpp>
-#include <boost/spirit/include/phoenix_operator.hpp>
-#include <boost/spirit/include/phoenix_object.hpp>
 
 #include "../../../shared/source/logger/logger.hpp"
+#include "../../../shared/source/market/price/price.hpp"
 
 namespace solution
 {
@@ -54,6 +50,10 @@ namespace solution
 
 			using path_t = boost::filesystem::path;
 
+		public:
+
+			using Price = shared::market::Price;
+
 		public:
 
 			struct Candle
@@ -61,19 +61,23 @@ namespace solution
 				using date_t = std::uint32_t;
 				using time_t = std::uint32_t;
 
-				using price_t = double;
+				using price_t = Price::ticks_t;
+
+				using scale_t = Price::scale_t;
 
 				using volume_t = std::uint64_t;
 
 				date_t date;
 				time_t time;
 
-				price_t price_open  = 0.0;
-				price_t price_high  = 0.0;
-				price_t price_low   = 0.0;
-				price_t price_close = 0.0;
+				price_t price_open  = 0;
+				price_t price_high  = 0;
+				price_t price_low   = 0;
+				price_t price_close = 0;
 
 				volume_t volume = 0;
+
+				scale_t scale = 0; // of prices, the same for all candles of a file
 			};
 
 		private:
@@ -82,36 +86,7 @@ namespace solution
 
 		private:
 
-			template < typename Iterator >
-			class Candle_Parser : 
-				public boost::spirit::qi::grammar < Iterator, Candle(), boost::spirit::qi::blank_type >
-			{
-			private:
-
-				using rule_t = boost::spirit::qi::rule < Iterator, Candle(), boost::spirit::qi::blank_type > ;
-
-			public:
-
-				Candle_Parser() : Candle_Parser::base_type(start)
-				{
-					static const auto separator = ','; 
-					
-					start %=
-						boost::spirit::qi::uint_   >> separator >>
-						boost::spirit::qi::uint_   >> separator >>
-						boost::spirit::qi::double_ >> separator >>
-						boost::spirit::qi::double_ >> separator >>
-						boost::spirit::qi::double_ >> separator >>
-						boost::spirit::qi::double_ >> separator >>
-						boost::spirit::qi::ulong_long;
-				}
-
-				~Candle_Parser() noexcept = default;
-
-			private:
-
-				 rule_t start;
-			};
+			using fields_container_t = std::vector < std::string_view > ;
 
 		public:
 
@@ -134,7 +109,13 @@ namespace solution
 
 		public:
 
-			static Candle parse(const std::string & s);
+			static Candle parse(const std::string & s, Candle::scale_t scale);
+
+			static Candle::scale_t scale(const std::string & s);
+
+		private:
+
+			static fields_container_t split(const std::string & s);
 
 		private:
 
@@ -161,16 +142,4 @@ namespace solution
 
 } // namespace solution
 
-BOOST_FUSION_ADAPT_STRUCT
-(
-	 solution::mapper::Mapper::Candle,
-	(solution::mapper::Mapper::Candle::date_t,   date)
-	(solution::mapper::Mapper::Candle::time_t,   time)
-	(solution::mapper::Mapper::Candle::price_t,  price_open)
-	(solution::mapper::Mapper::Candle::price_t,  price_high)
-	(solution::mapper::Mapper::Candle::price_t,  price_low)
-	(solution::mapper::Mapper::Candle::price_t,  price_close)
-	(solution::mapper::Mapper::Candle::volume_t, volume)
-)
-
 #endif // #ifndef SOLUTION_MAPPER_MAPPER_HPP
\ No newline at end of file
@@ -58,6 +58,141 @@ namespace solution
 			}
 		}
 
+		void Market::Data::load(Scheduler::Config & config)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				if (!boost::filesystem::exists(File::schedule))
+				{
+					return;
+				}
+
+				json_t object;
+
+				load(File::schedule, object);
+
+				if (object.count(Key::Schedule::live_period))
+				{
+					config.live_period = Scheduler::duration_t(
+						object[Key::Schedule::live_period].get < Scheduler::duration_t::rep > ());
+				}
+
+				if (object.count(Key::Schedule::check_period))
+				{
+					config.check_period = Scheduler::duration_t(
+						object[Key::Schedule::check_period].get < Scheduler::duration_t::rep > ());
+				}
+
+				if (object.count(Key::Schedule::quotes_period))
+				{
+					config.quotes_period = Scheduler::duration_t(
+						object[Key::Schedule::quotes_period].get < Scheduler::duration_t::rep > ());
+				}
+
+				if (config.live_period.count() <= 0 || config.check_period < config.live_period || config.quotes_period.count() <= 0)
+				{
+					throw market_exception("invalid schedule in file " + File::schedule.string());
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::load(const scales_container_t & scales, depths_container_t & depths)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				if (!boost::filesystem::exists(File::depths))
+				{
+					return;
+				}
+
+				json_t object;
+
+				load(File::depths, object);
+
+				for (const auto & scale : scales)
+				{
+					if (object.count(scale))
+					{
+						const auto depth = object[scale].get < std::size_t > ();
+
+						if (depth == 0)
+						{
+							throw market_exception("invalid depth of " + scale + " in file " + File::depths.string());
+						}
+
+						depths[scale] = depth;
+					}
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::load(Recorder::Config & config)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				if (!boost::filesystem::exists(File::record))
+				{
+					return;
+				}
+
+				json_t object;
+
+				load(File::record, object);
+
+				if (object.count(Key::Record::mode))
+				{
+					const auto mode = object[Key::Record::mode].get < std::string > ();
+
+					if (mode == "periodic")
+					{
+						config.mode = Recorder::Mode::periodic;
+					}
+					else if (mode == "change")
+					{
+						config.mode = Recorder::Mode::change;
+					}
+					else
+					{
+						throw market_exception("invalid record mode " + mode + " in file " + File::record.string());
+					}
+				}
+
+				if (object.count(Key::Record::throttle))
+				{
+					config.throttle = Recorder::duration_t(
+						object[Key::Record::throttle].get < Recorder::duration_t::rep > ());
+				}
+
+				if (object.count(Key::Record::capacity))
+				{
+					config.capacity = object[Key::Record::capacity].get < std::size_t > ();
+				}
+
+				if (config.throttle.count() < 0 || config.capacity == 0)
+				{
+					throw market_exception("invalid record config in file " + File::record.string());
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
 		void Market::Data::load(const path_t & path, json_t & object)
 		{
 			RUN_LOGGER(logger);
@@ -120,7 +255,7 @@ namespace solution
 		}
 		*/
 
-		void Market::initialize(const api_t & api)
+		void Market::initialize()
 		{
 			RUN_LOGGER(logger);
 
@@ -128,16 +263,42 @@ namespace solution
 			{
 				load();
 
+				const auto & shared_memory_name = Directory::Name::segment;
+
+				boost::interprocess::shared_memory_object::remove(shared_memory_name.c_str());
+
+				m_shared_memory = shared_memory_t(boost::interprocess::create_only,
+					shared_memory_name.c_str(), make_shared_memory_size());
+
+				m_directory = m_shared_memory.construct < Directory > (boost::interprocess::unique_instance) ();
+
+				const auto & telemetry_memory_name = Telemetry::Name::segment;
+
+				boost::interprocess::shared_memory_object::remove(telemetry_memory_name.c_str());
+
+				m_telemetry_memory = shared_memory_t(boost::interprocess::create_only,
+					telemetry_memory_name.c_str(), sizeof(Telemetry) + allocation_overhead + reserve_size);
+
+				m_telemetry = m_telemetry_memory.construct < Telemetry > (boost::interprocess::unique_instance) ();
+
+				m_scheduler = std::make_unique < Scheduler > (m_config);
+
+				m_recorder = std::make_unique < Recorder > (m_recorder_config);
+
 				for (const auto & asset : m_assets)
 				{
 					for (const auto & scale : m_scales)
 					{
 						m_sources.push_back(std::make_shared < Source > (
-							api, asset.first, asset.second, scale));
+							*m_provider, m_shared_memory, *m_telemetry, asset.first, asset.second, scale, depth(scale)));
+
+						m_scheduler->add(m_sources.back());
 					}
 
 					m_quotess.push_back(std::make_shared < Quotes > (
-						asset.first, asset.second, api));
+						asset.first, asset.second, *m_provider, m_shared_memory, *m_recorder, *m_telemetry));
+
+					m_scheduler->add(m_quotess.back());
 				}
 
 				m_status.store(Status::stopped);
@@ -155,6 +316,22 @@ namespace solution
 			try
 			{
 				stop();
+
+				if (m_directory)
+				{
+					m_directory->close();
+				}
+
+				m_scheduler.reset(); // shares sources and quotes, which write to the recorder and segments
+
+				m_sources.clear();
+				m_quotess.clear();
+
+				m_recorder.reset();
+
+				boost::interprocess::shared_memory_object::remove(Directory::Name::segment.c_str());
+
+				boost::interprocess::shared_memory_object::remove(Telemetry::Name::segment.c_str());
 			}
 			catch (const std::exception & exception)
 			{
@@ -170,6 +347,9 @@ namespace solution
 			{
 				load_assets();
 				load_scales();
+				load_config();
+				load_depths();
+				load_recorder_config();
 			}
 			catch (const std::exception & exception)
 			{
@@ -205,6 +385,90 @@ namespace solution
 			}
 		}
 
+		void Market::load_config()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Data::load(m_config);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::load_depths()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Data::load(m_scales, m_depths);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::load_recorder_config()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Data::load(m_recorder_config);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		std::size_t Market::depth(const std::string & scale) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				const auto iterator = m_depths.find(scale);
+
+				return (iterator == std::end(m_depths) ? Source::default_size : iterator->second);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		std::size_t Market::make_shared_memory_size() const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::size_t candles_size = 0;
+
+				for (const auto & scale : m_scales)
+				{
+					candles_size += sizeof(Candles::Header) + allocation_overhead + 
+						sizeof(Candles::Candle) * depth(scale) + allocation_overhead + cursors_size;
+				}
+
+				const auto quotes_size = sizeof(Book::Header) + allocation_overhead +
+					sizeof(Book::Diff) * Quotes::diffs_size + allocation_overhead;
+
+				return sizeof(Directory) + allocation_overhead + reserve_size +
+					m_assets.size() * (candles_size + quotes_size);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
 		void Market::run()
 		{
 			RUN_LOGGER(logger);
@@ -215,34 +479,26 @@ namespace solution
 
 				std::scoped_lock lock(m_mutex);
 
+				auto last_report = Scheduler::clock_t::now();
+
 				while (m_status.load() == Status::running)
 				{
-					for (const auto & source : m_sources)
-					{
-						try
-						{
-							source->update();
-						}
-						catch (...)
-						{
-							logger.write(Severity::error, source->asset_code() +
-								":" + source->scale_code() + "source update failed");
-						}
-					}
-					/*
-					for (const auto & quotes : m_quotess)
+					const auto now = Scheduler::clock_t::now();
+
+					const auto deadline = m_scheduler->run(now);
+
+					if (now - last_report >= report_period)
 					{
-						try
-						{
-							quotes->update();
-						}
-						catch (...)
-						{
-							logger.write(Severity::error, quotes->asset_code() + 
-								" quotes update failed");
-						}
+						logger.write(Severity::trace, "polls: " + 
+							std::to_string(m_scheduler->checks()) + " checks, " +
+							std::to_string(m_scheduler->lives())  + " lives, " +
+							std::to_string(m_scheduler->lates())  + " late lives, " +
+							std::to_string(m_scheduler->polls())  + " quotes polls");
+
+						last_report = now;
 					}
-					*/
+
+					std::this_thread::sleep_until(std::min(deadline, Scheduler::clock_t::now() + max_sleep_period));
 				}
 			}
 			catch (const std::exception & exception)
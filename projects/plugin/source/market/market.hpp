@@ -8,22 +8,30 @@
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
 #include <algorithm>
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
-#include <qluacpp/qlua> // !
-
 #include <boost/extended/application/service.hpp>
 #include <boost/extended/serialization/json.hpp>
-#include <boost/filesystem/path.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/managed_shared_memory.hpp>
 
-#include "source/source.hpp"
+#include "provider/provider.hpp"
 #include "quotes/quotes.hpp"
+#include "recorder/recorder.hpp"
+#include "scheduler/scheduler.hpp"
+#include "source/source.hpp"
 
 #include "../../../shared/source/logger/logger.hpp"
+#include "../../../shared/source/market/book/book.hpp"
+#include "../../../shared/source/market/candles/candles.hpp"
+#include "../../../shared/source/market/directory/directory.hpp"
+#include "../../../shared/source/market/telemetry/telemetry.hpp"
 
 namespace solution
 {
@@ -52,9 +60,23 @@ namespace solution
 
 			using Quotes = market::Quotes;
 
+			using Recorder = market::Recorder;
+
+			using Scheduler = market::Scheduler;
+
+			using Book = shared::market::Book;
+
+			using Candles = shared::market::Candles;
+
+			using Directory = shared::market::Directory;
+
+			using Telemetry = shared::market::Telemetry;
+
+			using shared_memory_t = boost::interprocess::managed_shared_memory;
+
 		public:
 
-			using api_t = Source::api_t;
+			using Provider = market::Provider;
 
 		private:
 
@@ -63,6 +85,8 @@ namespace solution
 			using assets_container_t = 
 				std::vector < std::pair < std::string, std::string > > ;
 
+			using depths_container_t = std::unordered_map < std::string, std::size_t > ;
+
 			using sources_container_t = std::vector < std::shared_ptr < Source > > ;
 
 			using quotess_container_t = std::vector < std::shared_ptr < Quotes > > ;
@@ -84,6 +108,21 @@ namespace solution
 						static inline const std::string class_code = "class_code";
 						static inline const std::string asset_code = "asset_code";
 					};
+
+					struct Schedule
+					{
+						static inline const std::string live_period  = "live_period";
+						static inline const std::string check_period = "check_period";
+
+						static inline const std::string quotes_period = "quotes_period";
+					};
+
+					struct Record
+					{
+						static inline const std::string mode     = "mode";
+						static inline const std::string throttle = "throttle";
+						static inline const std::string capacity = "capacity";
+					};
 				};
 
 			private:
@@ -92,8 +131,11 @@ namespace solution
 				{
 					using path_t = boost::filesystem::path;
 
-					static inline const path_t assets = "market/data/assets.data";
-					static inline const path_t scales = "market/data/scales.data";
+					static inline const path_t assets   = "market/data/assets.data";
+					static inline const path_t scales   = "market/data/scales.data";
+					static inline const path_t schedule = "market/data/schedule.data";
+					static inline const path_t depths   = "market/data/depths.data";
+					static inline const path_t record   = "market/data/record.data";
 				};
 
 			private:
@@ -106,6 +148,12 @@ namespace solution
 
 				static void load(scales_container_t & scales);
 
+				static void load(Scheduler::Config & config);
+
+				static void load(const scales_container_t & scales, depths_container_t & depths);
+
+				static void load(Recorder::Config & config);
+
 			private:
 
 				static void load(const path_t & path, json_t & object);				
@@ -156,9 +204,9 @@ namespace solution
 
 		public:
 
-			explicit Market(const api_t & api)
+			explicit Market(std::shared_ptr < Provider > provider) : m_provider(provider)
 			{
-				initialize(api);
+				initialize();
 			}
 
 			~Market() noexcept
@@ -175,7 +223,7 @@ namespace solution
 
 		private:
 
-			void initialize(const api_t & api);
+			void initialize();
 
 			void uninitialize();
 
@@ -189,6 +237,20 @@ namespace solution
 
 			void load_scales();
 
+			void load_config();
+
+			void load_depths();
+
+			void load_recorder_config();
+
+		private:
+
+			std::size_t depth(const std::string & scale) const;
+
+		private:
+
+			std::size_t make_shared_memory_size() const;
+
 		public:
 
 			const auto & assets() const noexcept
@@ -207,16 +269,56 @@ namespace solution
 
 			virtual void stop() override;
 
+		private:
+
+			static inline const std::size_t allocation_overhead = 256U;
+
+			static inline const std::size_t cursors_size = 1024U;
+
+			static inline const std::size_t reserve_size = 65536U;
+
+		private:
+
+			static inline const Scheduler::duration_t max_sleep_period = Scheduler::duration_t(100);
+
+			static inline const Scheduler::duration_t report_period = Scheduler::duration_t(60000);
+
+		private:
+
+			std::shared_ptr < Provider > m_provider;
+
 		private:
 
 			assets_container_t m_assets;
 
 			scales_container_t m_scales;
 
+			depths_container_t m_depths;
+
+			Scheduler::Config m_config;
+
+			Recorder::Config m_recorder_config;
+
+		private:
+
+			shared_memory_t m_shared_memory;
+
+			Directory * m_directory = nullptr;
+
+			shared_memory_t m_telemetry_memory;
+
+			Telemetry * m_telemetry = nullptr;
+
+		private:
+
 			sources_container_t m_sources;
 
 			quotess_container_t m_quotess;
 
+			std::unique_ptr < Recorder > m_recorder;
+
+			std::unique_ptr < Scheduler > m_scheduler;
+
 		private:
 
 			mutable std::mutex m_mutex;
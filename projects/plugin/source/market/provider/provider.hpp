@@ -0,0 +1,161 @@
+#ifndef SOLUTION_PLUGIN_MARKET_PROVIDER_HPP
+#define SOLUTION_PLUGIN_MARKET_PROVIDER_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../../../shared/source/logger/logger.hpp"
+#include "../../../../shared/source/market/candles/candles.hpp"
+#include "../../../../shared/source/market/price/price.hpp"
+
+namespace solution
+{
+	namespace plugin
+	{
+		namespace market
+		{
+			class provider_exception : public std::exception
+			{
+			public:
+
+				explicit provider_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit provider_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~provider_exception() noexcept = default;
+			};
+
+			// source of candles and level II quotes for Source and Quotes, the
+			// terminal is reached through Qlua, recorded files through Replay
+
+			class Provider
+			{
+			public:
+
+				using Candle = shared::market::Candle;
+
+				using index_t = Candle::index_t;
+
+				using timeframe_t = std::chrono::seconds;
+
+				using Price = shared::market::Price;
+
+				using price_t = Price::ticks_t;
+
+				using scale_t = Price::scale_t;
+
+				using volume_t = std::uint64_t;
+
+				using orders_container_t = std::vector < std::pair < price_t, volume_t > > ;
+
+			public:
+
+				class Series
+				{
+				public:
+
+					virtual ~Series() noexcept = default;
+
+				public:
+
+					virtual index_t size() const = 0;
+
+					virtual Candle candle(index_t index) const = 0; // indices start from 1
+				};
+
+			public:
+
+				virtual ~Provider() noexcept = default;
+
+			public:
+
+				virtual std::unique_ptr < Series > make_series(const std::string & class_code, 
+					const std::string & asset_code, const std::string & scale_code) = 0;
+
+				virtual timeframe_t timeframe(const std::string & scale_code) const = 0;
+
+				// real time left until the time point of the provider clock
+
+				virtual timeframe_t duration_until(std::time_t time) const
+				{
+					return timeframe_t(time - std::time(nullptr));
+				}
+
+				// number of decimal digits in prices of the asset, candles and quotes
+				// of the asset are returned in ticks of this scale
+
+				virtual scale_t scale(const std::string & class_code, const std::string & asset_code) = 0;
+
+				// minimum change of prices of the asset in ticks of its scale, one
+				// tick when the provider does not know it
+
+				virtual price_t step(const std::string & class_code, const std::string & asset_code)
+				{
+					return 1;
+				}
+
+			public:
+
+				virtual void subscribe(const std::string & class_code, const std::string & asset_code) = 0;
+
+				// asks and bids are filled from the best level up to their sizes
+
+				virtual void get_quotes(const std::string & class_code, const std::string & asset_code, 
+					orders_container_t & asks, orders_container_t & bids) = 0;
+
+			public:
+
+				// time of the open of a candle, the terminal time zone is assumed to
+				// be the local one
+
+				virtual std::time_t make_time(const Candle & candle) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						std::tm time = {};
+
+						time.tm_year = static_cast < int > (candle.date / 10000) - 1900;
+						time.tm_mon  = static_cast < int > (candle.date / 100 % 100) - 1;
+						time.tm_mday = static_cast < int > (candle.date % 100);
+
+						time.tm_hour = static_cast < int > (candle.time / 10000);
+						time.tm_min  = static_cast < int > (candle.time / 100 % 100);
+						time.tm_sec  = static_cast < int > (candle.time % 100);
+
+						time.tm_isdst = -1;
+
+						return std::mktime(&time);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < provider_exception > (logger, exception);
+					}
+				}
+			};
+
+		} // namespace market
+
+	} // namespace plugin
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_PLUGIN_MARKET_PROVIDER_HPP
\ No newline at end of file
@@ -0,0 +1,213 @@
+#include "qlua.hpp"
+
+namespace solution
+{
+	namespace plugin
+	{
+		namespace market
+		{
+			Qlua::index_t Qlua::Series::size() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return static_cast < index_t > (m_source->Size());
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < qlua_exception > (logger, exception);
+				}
+			}
+
+			Qlua::Candle Qlua::Series::candle(index_t index) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					Candle candle;
+
+					candle.index = index;
+
+					const auto time = m_source->T(index);
+
+					candle.date = static_cast < Candle::date_t > (time.year * 10000 + time.month * 100 + time.day);
+					candle.time = static_cast < Candle::time_t > (time.hour * 10000 + time.min   * 100 + time.sec);
+
+					candle.price_open  = Price::from_double(m_source->O(index), m_scale);
+					candle.price_high  = Price::from_double(m_source->H(index), m_scale);
+					candle.price_low   = Price::from_double(m_source->L(index), m_scale);
+					candle.price_close = Price::from_double(m_source->C(index), m_scale);
+
+					candle.volume = static_cast < Candle::volume_t > (m_source->V(index));
+
+					return candle;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < qlua_exception > (logger, exception);
+				}
+			}
+
+			std::unique_ptr < Provider::Series > Qlua::make_series(const std::string & class_code,
+				const std::string & asset_code, const std::string & scale_code)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return std::make_unique < Series > (m_api.CreateDataSource(
+						class_code.c_str(), asset_code.c_str(), make_interval(scale_code)), scale(class_code, asset_code));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < qlua_exception > (logger, exception);
+				}
+			}
+
+			Qlua::timeframe_t Qlua::timeframe(const std::string & scale_code) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					// interval constants are durations in minutes except INTERVAL_MN1
+
+					return std::chrono::minutes(scale_code == "MN1" ? 31U * 24U * 60U : make_interval(scale_code));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < qlua_exception > (logger, exception);
+				}
+			}
+
+			Qlua::scale_t Qlua::scale(const std::string & class_code, const std::string & asset_code)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto key = class_code + ":" + asset_code; // an asset code may be listed in several classes
+
+					if (auto iterator = m_scales.find(key); iterator != std::end(m_scales))
+					{
+						return iterator->second;
+					}
+
+					scale_t scale = 0;
+
+					m_api.getSecurityInfo(class_code.c_str(), asset_code.c_str(), [&scale](const auto & security)
+					{
+						scale = static_cast < scale_t > (security().scale());
+					});
+
+					if (scale > Price::max_scale)
+					{
+						throw qlua_exception("invalid scale of " + class_code + " : " + asset_code);
+					}
+
+					return m_scales.emplace(key, scale).first->second;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < qlua_exception > (logger, exception);
+				}
+			}
+
+			Qlua::price_t Qlua::step(const std::string & class_code, const std::string & asset_code)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					double step = 0.0;
+
+					m_api.getSecurityInfo(class_code.c_str(), asset_code.c_str(), [&step](const auto & security)
+					{
+						step = static_cast < double > (security().min_price_step());
+					});
+
+					return std::max(Price::from_double(step, scale(class_code, asset_code)), price_t(1));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < qlua_exception > (logger, exception);
+				}
+			}
+
+			void Qlua::subscribe(const std::string & class_code, const std::string & asset_code)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (!m_api.Subscribe_Level_II_Quotes(class_code.c_str(), asset_code.c_str()))
+					{
+						throw qlua_exception("cannot subscribe to " + class_code + " : " + asset_code);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < qlua_exception > (logger, exception);
+				}
+			}
+
+			void Qlua::get_quotes(const std::string & class_code, const std::string & asset_code,
+				orders_container_t & asks, orders_container_t & bids)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto price_scale = scale(class_code, asset_code);
+
+					// prices come as decimal strings and are parsed into ticks exactly
+
+					m_api.getQuoteLevel2(class_code.c_str(), asset_code.c_str(), [&asks, &bids, price_scale](const auto & quotes)
+					{
+						auto bid = quotes.bid();
+						auto ask = quotes.offer();
+
+						for (std::size_t i = 0; i < std::min(asks.size(), ask.size()); ++i)
+						{
+							auto & ask_ref = ask[i];
+
+							asks.at(i) = std::make_pair(Price::parse(ask_ref.price, price_scale),
+								static_cast < volume_t > (Price::parse(ask_ref.quantity, 0U)));
+						}
+
+						for (std::size_t i = 0; i < std::min(bids.size(), bid.size()); ++i)
+						{
+							auto & bid_ref = bid[bid.size() - 1 - i];
+
+							bids.at(i) = std::make_pair(Price::parse(bid_ref.price, price_scale),
+								static_cast < volume_t > (Price::parse(bid_ref.quantity, 0U)));
+						}
+					});
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < qlua_exception > (logger, exception);
+				}
+			}
+
+			unsigned int Qlua::make_interval(const std::string & scale_code) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return m_api.constant < unsigned int > (("INTERVAL_" + scale_code).c_str());
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < qlua_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace plugin
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,129 @@
+#ifndef SOLUTION_PLUGIN_MARKET_PROVIDER_QLUA_HPP
+#define SOLUTION_PLUGIN_MARKET_PROVIDER_QLUA_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include <qluacpp/qlua>
+
+#include "../provider.hpp"
+
+#include "../../../config/config.hpp"
+
+#include "../../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace plugin
+	{
+		namespace market
+		{
+			class qlua_exception : public std::exception
+			{
+			public:
+
+				explicit qlua_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit qlua_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~qlua_exception() noexcept = default;
+			};
+
+			class Qlua : public Provider
+			{
+			public:
+
+				using api_t = Config::api_t;
+
+			private:
+
+				class Series : public Provider::Series
+				{
+				private:
+
+					using source_t = qlua::data_source;
+
+				public:
+
+					explicit Series(source_t && source, scale_t scale) :
+						m_source(std::make_unique < source_t > (std::move(source))), m_scale(scale)
+					{}
+
+					~Series() noexcept = default;
+
+				public:
+
+					index_t size() const override;
+
+					Candle candle(index_t index) const override;
+
+				private:
+
+					std::unique_ptr < source_t > m_source;
+
+					const scale_t m_scale;
+				};
+
+			private:
+
+				using scales_container_t = std::unordered_map < std::string, scale_t > ; // by class and asset code
+
+			public:
+
+				explicit Qlua(const api_t & api) : m_api(api)
+				{}
+
+				~Qlua() noexcept = default;
+
+			public:
+
+				std::unique_ptr < Provider::Series > make_series(const std::string & class_code,
+					const std::string & asset_code, const std::string & scale_code) override;
+
+				timeframe_t timeframe(const std::string & scale_code) const override;
+
+				scale_t scale(const std::string & class_code, const std::string & asset_code) override;
+
+				price_t step(const std::string & class_code, const std::string & asset_code) override;
+
+			public:
+
+				void subscribe(const std::string & class_code, const std::string & asset_code) override;
+
+				void get_quotes(const std::string & class_code, const std::string & asset_code,
+					orders_container_t & asks, orders_container_t & bids) override;
+
+			private:
+
+				unsigned int make_interval(const std::string & scale_code) const;
+
+			private:
+
+				api_t m_api;
+
+				scales_container_t m_scales;
+			};
+
+		} // namespace market
+
+	} // namespace plugin
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_PLUGIN_MARKET_PROVIDER_QLUA_HPP
\ No newline at end of file
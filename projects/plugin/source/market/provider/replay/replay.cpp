@@ -0,0 +1,513 @@
+#include "replay.hpp"
+
+namespace solution
+{
+	namespace plugin
+	{
+		namespace market
+		{
+			Replay::time_point_t Replay::Clock::now()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (!m_is_started)
+					{
+						m_start = clock_t::now();
+
+						m_is_started = true;
+					}
+
+					const auto elapsed = std::chrono::duration < double, std::nano > (clock_t::now() - m_start).count() * m_speed;
+
+					return m_origin + static_cast < time_point_t > (elapsed);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			Replay::index_t Replay::Series::size() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return static_cast < index_t > (std::distance(std::begin(m_times),
+						std::upper_bound(std::begin(m_times), std::end(m_times), m_clock->now())));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			Replay::Candle Replay::Series::candle(index_t index) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (index == 0 || index > m_candles.size())
+					{
+						throw replay_exception("invalid candle index " + std::to_string(index));
+					}
+
+					return m_candles[index - 1];
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			std::unique_ptr < Provider::Series > Replay::make_series(const std::string & class_code,
+				const std::string & asset_code, const std::string & scale_code)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto path = m_directory; path /= asset_code + "_" + scale_code + Extension::txt;
+
+					std::fstream fin(path.string(), std::ios::in);
+
+					if (!fin)
+					{
+						throw replay_exception("cannot open file " + path.string());
+					}
+
+					const auto price_scale = scale(class_code, asset_code);
+
+					times_container_t times;
+
+					candles_container_t candles;
+
+					std::string line;
+
+					std::getline(fin, line); // header
+
+					while (std::getline(fin, line))
+					{
+						const auto fields = split(line);
+
+						if (fields.size() < 7U)
+						{
+							continue;
+						}
+
+						Candle candle;
+
+						candle.index = candles.size() + 1;
+
+						candle.date = static_cast < Candle::date_t > (std::stoul(fields[0]));
+						candle.time = static_cast < Candle::time_t > (std::stoul(fields[1]));
+
+						candle.price_open  = Price::parse(fields[2], price_scale);
+						candle.price_high  = Price::parse(fields[3], price_scale);
+						candle.price_low   = Price::parse(fields[4], price_scale);
+						candle.price_close = Price::parse(fields[5], price_scale);
+
+						candle.volume = static_cast < Candle::volume_t > (std::stoull(fields[6]));
+
+						times.push_back(make_time_point(candle.date, candle.time));
+
+						candles.push_back(candle);
+					}
+
+					if (!times.empty())
+					{
+						m_clock->extend(times.front());
+					}
+
+					return std::make_unique < Series > (m_clock, std::move(times), std::move(candles));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			Replay::timeframe_t Replay::timeframe(const std::string & scale_code) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (scale_code == "TICK")
+					{
+						return timeframe_t(0);
+					}
+
+					if (scale_code.rfind("MN", 0) == 0)
+					{
+						return std::chrono::hours(31 * 24);
+					}
+
+					const auto quantity = std::stoul(scale_code.substr(1));
+
+					switch (scale_code.front())
+					{
+					case 'M':
+						return std::chrono::minutes(quantity);
+					case 'H':
+						return std::chrono::hours(quantity);
+					case 'D':
+						return std::chrono::hours(quantity * 24);
+					case 'W':
+						return std::chrono::hours(quantity * 24 * 7);
+					default:
+						throw replay_exception("unknown scale " + scale_code);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			Replay::timeframe_t Replay::duration_until(std::time_t time) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto duration = static_cast < double > (time * nanoseconds_per_second - m_clock->now());
+
+					return timeframe_t(static_cast < timeframe_t::rep > (duration / nanoseconds_per_second / m_clock->speed()));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			std::time_t Replay::make_time(const Candle & candle) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return static_cast < std::time_t > (make_time_point(candle.date, candle.time) / nanoseconds_per_second);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			Replay::scale_t Replay::scale(const std::string & class_code, const std::string & asset_code)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (auto iterator = m_scales.find(asset_code); iterator != std::end(m_scales))
+					{
+						return iterator->second;
+					}
+
+					using Record = shared::market::Record;
+
+					scale_t scale = 0;
+
+					const auto prefix = asset_code + "_";
+
+					for (const auto & entry : boost::filesystem::directory_iterator(m_directory))
+					{
+						if (entry.path().filename().string().rfind(prefix, 0) != 0)
+						{
+							continue;
+						}
+
+						if (const auto extension = entry.path().extension().string(); extension == Record::Extension::book)
+						{
+							scale = std::max(scale, shared::market::Reader(entry.path()).scale());
+						}
+						else if (extension == Extension::txt)
+						{
+							std::fstream fin(entry.path().string(), std::ios::in);
+
+							std::string line;
+
+							std::getline(fin, line); // header
+
+							if (std::getline(fin, line))
+							{
+								const auto fields = split(line);
+
+								for (std::size_t i = 2U; i < std::min(fields.size(), std::size_t(6U)); ++i)
+								{
+									scale = std::max(scale, Price::decimals(fields[i]));
+								}
+							}
+						}
+					}
+
+					if (const auto path = make_text_path(asset_code); boost::filesystem::exists(path))
+					{
+						std::fstream fin(path.string(), std::ios::in);
+
+						std::string line;
+
+						if (std::getline(fin, line))
+						{
+							const auto fields = split(line);
+
+							for (std::size_t i = 2U; i < fields.size(); i += 2U) // prices, volumes follow them
+							{
+								scale = std::max(scale, Price::decimals(fields[i]));
+							}
+						}
+					}
+
+					return m_scales.emplace(asset_code, scale).first->second;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			void Replay::subscribe(const std::string & class_code, const std::string & asset_code)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					using Record = shared::market::Record;
+
+					std::vector < path_t > paths;
+
+					const auto prefix = asset_code + "_";
+
+					for (const auto & entry : boost::filesystem::directory_iterator(m_directory))
+					{
+						const auto file = entry.path().filename().string();
+
+						if (file.rfind(prefix, 0) == 0 && entry.path().extension().string() == Record::Extension::book)
+						{
+							paths.push_back(entry.path());
+						}
+					}
+
+					const auto text_path = make_text_path(asset_code);
+
+					if (paths.empty() && !boost::filesystem::exists(text_path))
+					{
+						throw replay_exception("no book records of " + asset_code + " in " + m_directory.string());
+					}
+
+					std::sort(std::begin(paths), std::end(paths)); // dates in names sort chronologically
+
+					const auto price_scale = scale(class_code, asset_code);
+
+					auto & snapshots = m_books[asset_code];
+
+					for (const auto & path : paths)
+					{
+						load_book(path, price_scale, snapshots);
+					}
+
+					if (paths.empty())
+					{
+						load_text(text_path, price_scale, snapshots);
+					}
+
+					if (!snapshots.empty())
+					{
+						m_clock->extend(snapshots.front().time);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			void Replay::get_quotes(const std::string & class_code, const std::string & asset_code,
+				orders_container_t & asks, orders_container_t & bids)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto & snapshots = m_books.at(asset_code);
+
+					const auto now = m_clock->now();
+
+					auto snapshot = std::upper_bound(std::begin(snapshots), std::end(snapshots), now,
+						[](auto time, const auto & snapshot) { return time < snapshot.time; });
+
+					if (snapshot == std::begin(snapshots))
+					{
+						return;
+					}
+
+					--snapshot;
+
+					std::copy_n(std::begin(snapshot->asks), std::min(asks.size(), snapshot->asks.size()), std::begin(asks));
+					std::copy_n(std::begin(snapshot->bids), std::min(bids.size(), snapshot->bids.size()), std::begin(bids));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			Replay::time_point_t Replay::make_time_point(Candle::date_t date, Candle::time_t time) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					using Record = shared::market::Record;
+
+					const auto seconds = Record::make_day(date) * 86400LL +
+						(time / 10000) * 3600LL + (time / 100 % 100) * 60LL + (time % 100) - m_utc_offset.count();
+
+					return seconds * nanoseconds_per_second;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			void Replay::load_book(const path_t & path, scale_t price_scale, snapshots_container_t & snapshots) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					shared::market::Reader reader(path);
+
+					const auto factor = Price::power(price_scale - reader.scale());
+
+					shared::market::Record::Snapshot record;
+
+					while (reader.next(record))
+					{
+						Snapshot snapshot { record.timestamp,
+							orders_container_t(std::size(record.asks)), orders_container_t(std::size(record.bids)) };
+
+						for (std::size_t i = 0; i < snapshot.asks.size(); ++i)
+						{
+							snapshot.asks[i] = std::make_pair(record.asks[i].price * factor, record.asks[i].volume);
+							snapshot.bids[i] = std::make_pair(record.bids[i].price * factor, record.bids[i].volume);
+						}
+
+						snapshots.push_back(std::move(snapshot));
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			// a line of the former Quotes: date, time, asks from the worst level to
+			// the best one and bids from the best level, each as price and volume,
+			// one line per second at most
+
+			void Replay::load_text(const path_t & path, scale_t price_scale, snapshots_container_t & snapshots) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::fstream fin(path.string(), std::ios::in);
+
+					if (!fin)
+					{
+						throw replay_exception("cannot open file " + path.string());
+					}
+
+					std::string line;
+
+					while (std::getline(fin, line))
+					{
+						const auto fields = split(line);
+
+						if (fields.size() < 6U || (fields.size() - 2U) % 4U != 0U)
+						{
+							continue;
+						}
+
+						const auto depth = (fields.size() - 2U) / 4U;
+
+						Snapshot snapshot { make_time_point(
+							static_cast < Candle::date_t > (std::stoul(fields[0])),
+							static_cast < Candle::time_t > (std::stoul(fields[1]))),
+							orders_container_t(depth), orders_container_t(depth) };
+
+						for (std::size_t i = 0; i < depth; ++i)
+						{
+							const auto ask = 2U + 2U * (depth - 1U - i);
+							const auto bid = 2U + 2U * (depth + i);
+
+							snapshot.asks[i] = std::make_pair(Price::parse(fields[ask], price_scale),
+								static_cast < volume_t > (std::stoull(fields[ask + 1U])));
+							snapshot.bids[i] = std::make_pair(Price::parse(fields[bid], price_scale),
+								static_cast < volume_t > (std::stoull(fields[bid + 1U])));
+						}
+
+						snapshots.push_back(std::move(snapshot));
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			Replay::path_t Replay::make_text_path(const std::string & asset_code) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto path = m_directory; path /= quotes_directory; path /= asset_code + Extension::txt;
+
+					return path;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+			std::vector < std::string > Replay::split(const std::string & line)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					static const auto delimeter = ',';
+
+					std::vector < std::string > fields;
+
+					std::stringstream sin(line);
+
+					std::string field;
+
+					while (std::getline(sin, field, delimeter))
+					{
+						fields.push_back(field);
+					}
+
+					return fields;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < replay_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace plugin
+
+} // namespace solution
\ No newline at end of file
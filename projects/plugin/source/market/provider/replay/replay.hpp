@@ -0,0 +1,256 @@
+#ifndef SOLUTION_PLUGIN_MARKET_PROVIDER_REPLAY_HPP
+#define SOLUTION_PLUGIN_MARKET_PROVIDER_REPLAY_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "../provider.hpp"
+
+#include "../../../../../shared/source/logger/logger.hpp"
+#include "../../../../../shared/source/market/record/record.hpp"
+
+namespace solution
+{
+	namespace plugin
+	{
+		namespace market
+		{
+			class replay_exception : public std::exception
+			{
+			public:
+
+				explicit replay_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit replay_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~replay_exception() noexcept = default;
+			};
+
+			// plays recorded candles (<asset>_<scale>.txt in the format written by
+			// action market) and level II snapshots (<asset>_<date>.book written by
+			// Recorder, or quotes/<asset>.txt written by the former Quotes when an
+			// asset has no book records) from one directory, the price scale of an
+			// asset is the largest one of its files, replay time starts at the
+			// earliest record with the first request and runs speed times faster
+			// than real time, a candle is visible as a whole from its open time,
+			// replay time is kept in nanoseconds of UTC as book timestamps, times
+			// of candles and text quotes are exchange times shifted by the UTC
+			// offset of the exchange, so the time zone of the host does not matter
+
+			class Replay : public Provider
+			{
+			public:
+
+				using path_t = boost::filesystem::path;
+
+				using speed_t = double;
+
+				using time_point_t = std::int64_t; // nanoseconds since epoch, UTC
+
+			private:
+
+				class Clock
+				{
+				private:
+
+					using clock_t = std::chrono::steady_clock;
+
+				public:
+
+					explicit Clock(speed_t speed) noexcept : m_speed(speed)
+					{}
+
+					~Clock() noexcept = default;
+
+				public:
+
+					void extend(time_point_t time) noexcept
+					{
+						if (m_origin == 0 || time < m_origin)
+						{
+							m_origin = time;
+						}
+					}
+
+					time_point_t now(); // starts the clock on the first call
+
+					const auto & speed() const noexcept
+					{
+						return m_speed;
+					}
+
+				private:
+
+					const speed_t m_speed;
+
+					time_point_t m_origin = 0;
+
+				private:
+
+					clock_t::time_point m_start;
+
+					bool m_is_started = false;
+				};
+
+			private:
+
+				using times_container_t = std::vector < time_point_t > ;
+
+				using candles_container_t = std::vector < Candle > ;
+
+			private:
+
+				class Series : public Provider::Series
+				{
+				public:
+
+					explicit Series(std::shared_ptr < Clock > clock, times_container_t && times, candles_container_t && candles) :
+						m_clock(clock), m_times(std::move(times)), m_candles(std::move(candles))
+					{}
+
+					~Series() noexcept = default;
+
+				public:
+
+					index_t size() const override;
+
+					Candle candle(index_t index) const override;
+
+				private:
+
+					const std::shared_ptr < Clock > m_clock; // shared with the replay
+
+					const times_container_t m_times;
+
+					const candles_container_t m_candles;
+				};
+
+			private:
+
+				struct Snapshot
+				{
+					time_point_t time;
+
+					orders_container_t asks;
+					orders_container_t bids;
+				};
+
+			private:
+
+				using snapshots_container_t = std::vector < Snapshot > ;
+
+				using books_container_t = std::unordered_map < std::string, snapshots_container_t > ;
+
+				using scales_container_t = std::unordered_map < std::string, scale_t > ;
+
+			private:
+
+				struct Extension
+				{
+					using extension_t = std::string;
+
+					static inline const extension_t txt = ".txt";
+				};
+
+			public:
+
+				explicit Replay(speed_t speed = default_speed, const path_t & directory = default_directory,
+					timeframe_t utc_offset = default_utc_offset) :
+						m_clock(std::make_shared < Clock > (speed)), m_directory(directory), m_utc_offset(utc_offset)
+				{}
+
+				~Replay() noexcept = default;
+
+			public:
+
+				std::unique_ptr < Provider::Series > make_series(const std::string & class_code,
+					const std::string & asset_code, const std::string & scale_code) override;
+
+				timeframe_t timeframe(const std::string & scale_code) const override;
+
+				timeframe_t duration_until(std::time_t time) const override;
+
+				std::time_t make_time(const Candle & candle) const override;
+
+				scale_t scale(const std::string & class_code, const std::string & asset_code) override;
+
+			public:
+
+				void subscribe(const std::string & class_code, const std::string & asset_code) override;
+
+				void get_quotes(const std::string & class_code, const std::string & asset_code,
+					orders_container_t & asks, orders_container_t & bids) override;
+
+			private:
+
+				time_point_t make_time_point(Candle::date_t date, Candle::time_t time) const;
+
+				void load_book(const path_t & path, scale_t price_scale, snapshots_container_t & snapshots) const;
+
+				void load_text(const path_t & path, scale_t price_scale, snapshots_container_t & snapshots) const;
+
+				path_t make_text_path(const std::string & asset_code) const;
+
+			private:
+
+				static std::vector < std::string > split(const std::string & line);
+
+			public:
+
+				static inline const speed_t default_speed = 1.0;
+
+				static inline const path_t default_directory = "market/replay";
+
+				static inline const timeframe_t default_utc_offset = std::chrono::hours(3); // Moscow Exchange
+
+			private:
+
+				static inline const path_t quotes_directory = "quotes"; // of the former Quotes
+
+				static constexpr time_point_t nanoseconds_per_second = 1000000000LL;
+
+			private:
+
+				const std::shared_ptr < Clock > m_clock;
+
+				const path_t m_directory;
+
+				const timeframe_t m_utc_offset;
+
+			private:
+
+				books_container_t m_books;
+
+				scales_container_t m_scales;
+			};
+
+		} // namespace market
+
+	} // namespace plugin
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_PLUGIN_MARKET_PROVIDER_REPLAY_HPP
\ No newline at end of file
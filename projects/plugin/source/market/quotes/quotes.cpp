@@ -14,35 +14,35 @@ namespace solution
 
 				try
 				{
-					if (!m_api.Subscribe_Level_II_Quotes(m_class_code.c_str(), m_asset_code.c_str()))
-					{
-						throw quotes_exception("cannot subscribe to " + m_class_code + " : " + m_asset_code);
-					}
+					m_provider.subscribe(m_class_code, m_asset_code);
 
-					const auto shared_memory_name = make_shared_memory_name();
+					m_header = m_shared_memory.construct < Book::Header > (boost::interprocess::anonymous_instance) ();
+					m_diffs  = m_shared_memory.construct < Book::Diff > (boost::interprocess::anonymous_instance) [diffs_size] ();
 
-					const auto shared_memory_size = 1024U;
+					m_header->scale = m_provider.scale(m_class_code, m_asset_code);
+					m_header->step  = m_provider.step (m_class_code, m_asset_code);
 
-					boost::interprocess::shared_memory_object::remove(shared_memory_name.c_str());
+					m_book = std::make_unique < Book > (m_header, m_diffs, diffs_size);
 
-					m_shared_memory = shared_memory_t(boost::interprocess::create_only,
-						shared_memory_name.c_str(), shared_memory_size);
+					m_directory = m_shared_memory.find < Directory > (boost::interprocess::unique_instance).first;
 
-					m_mutex = m_shared_memory.construct < mutex_t > (boost::interprocess::unique_instance) ();
+					if (!m_directory)
+					{
+						throw quotes_exception("directory not found");
+					}
 
-					m_total_ask = m_shared_memory.construct < volume_t > (Name::total_ask.c_str())();
-					m_total_bid = m_shared_memory.construct < volume_t > (Name::total_bid.c_str())();
+					m_directory->append(m_asset_code, Directory::Name::quotes,
+						m_shared_memory.get_handle_from_address(m_header),
+						m_shared_memory.get_handle_from_address(m_diffs), diffs_size);
 
 					m_asks.resize(depth);
 					m_bids.resize(depth);
 
 					reset_orders();
 
-					boost::filesystem::create_directory(directory);
+					m_entry = &m_telemetry.append(m_asset_code, Directory::Name::quotes);
 
-					path_t file = m_asset_code + Extension::txt;
-
-					(m_path = directory) /= file;
+					m_channel = m_recorder.add(m_asset_code, m_header->scale, m_entry);
 				}
 				catch (const std::exception & exception)
 				{
@@ -56,28 +56,8 @@ namespace solution
 
 				try
 				{
-					m_shared_memory.destroy_ptr(m_mutex);
-
-					m_shared_memory.destroy_ptr(m_total_ask);
-					m_shared_memory.destroy_ptr(m_total_bid);
-
-					const auto shared_memory_name = make_shared_memory_name();
-
-					boost::interprocess::shared_memory_object::remove(shared_memory_name.c_str());
-				}
-				catch (const std::exception & exception)
-				{
-					shared::catch_handler < quotes_exception > (logger, exception);
-				}
-			}
-
-			std::string Quotes::make_shared_memory_name() const
-			{
-				RUN_LOGGER(logger);
-
-				try
-				{
-					return "QUIK_" + m_asset_code + "_quotes";
+					m_shared_memory.destroy_ptr(m_header);
+					m_shared_memory.destroy_ptr(m_diffs);
 				}
 				catch (const std::exception & exception)
 				{
@@ -91,50 +71,82 @@ namespace solution
 
 				try
 				{
+					const auto asks = m_asks;
+					const auto bids = m_bids;
+
 					reset_orders();
 
+					const auto start = std::chrono::steady_clock::now();
+
+					auto is_published = false;
+
 					try
 					{
-						m_api.getQuoteLevel2(m_class_code.c_str(), m_asset_code.c_str(), [this](const auto & quotes)
-						{
-							auto bid = quotes.bid();
-							auto ask = quotes.offer();
+						Telemetry::add(m_entry->calls);
 
-							volume_t total_ask = 0;
-							volume_t total_bid = 0;
+						m_provider.get_quotes(m_class_code, m_asset_code, m_asks, m_bids);
 
-							for (std::size_t i = 0; i < std::min(depth, ask.size()); ++i)
-							{
-								auto & ask_ref = ask[i];
+						const auto snapshot = make_snapshot();
 
-								m_asks.at(i) = std::make_pair(
-									atof(ask_ref.price.c_str()), atoi(ask_ref.quantity.c_str()));
+						m_book->publish(snapshot, Book::make_features(snapshot, m_header->step));
 
-								total_ask += m_asks.at(i).second;
-							}
+						is_published = true;
 
-							for (std::size_t i = 0; i < std::min(depth, bid.size()); ++i)
-							{
-								auto & bid_ref = bid[bid.size() - 1 - i];
+						const auto is_changed = (m_asks != asks || m_bids != bids);
 
-								m_bids.at(i) = std::make_pair(
-									atof(bid_ref.price.c_str()), atoi(bid_ref.quantity.c_str()));
+						if (is_changed)
+						{
+							m_book->event().notify();
 
-								total_bid += m_bids.at(i).second;
-							}
+							m_directory->event().notify();
+						}
 
-							boost::interprocess::scoped_lock < mutex_t > lock(*m_mutex);
+						record(snapshot, is_changed);
 
-							*m_total_ask = total_ask;
-							*m_total_bid = total_bid;
-						});
+						Telemetry::complete(*m_entry, std::chrono::steady_clock::now() - start);
 					}
 					catch (...)
 					{
+						if (!is_published) // orders stay as published, so the next update is compared with them
+						{
+							m_asks = asks;
+							m_bids = bids;
+						}
+
+						Telemetry::add(m_entry->errors);
+
 						logger.write(Severity::error, m_asset_code + " quotes update failed");
 					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < quotes_exception > (logger, exception);
+				}
+			}
+
+			Quotes::Book::Snapshot Quotes::make_snapshot() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					Book::Snapshot snapshot;
+
+					snapshot.monotonic = std::chrono::duration_cast < std::chrono::nanoseconds > (
+						std::chrono::steady_clock::now().time_since_epoch()).count();
+
+					snapshot.timestamp = Recorder::Record::make_wall(m_recorder.anchor(), snapshot.monotonic);
+
+					for (std::size_t i = 0; i < depth; ++i)
+					{
+						snapshot.asks[i] = Book::Level { m_asks.at(i).first, m_asks.at(i).second };
+						snapshot.bids[i] = Book::Level { m_bids.at(i).first, m_bids.at(i).second };
+
+						snapshot.total_ask += m_asks.at(i).second;
+						snapshot.total_bid += m_bids.at(i).second;
+					}
 
-					save();
+					return snapshot;
 				}
 				catch (const std::exception & exception)
 				{
@@ -150,12 +162,12 @@ namespace solution
 				{
 					for (auto & order : m_asks)
 					{
-						order = std::make_pair(0.0, 0);
+						order = std::make_pair(price_t(0), volume_t(0));
 					}
 
 					for (auto & order : m_bids)
 					{
-						order = std::make_pair(0.0, 0);
+						order = std::make_pair(price_t(0), volume_t(0));
 					}
 				}
 				catch (const std::exception & exception)
@@ -164,57 +176,15 @@ namespace solution
 				}
 			}
 
-			void Quotes::save() const
+			void Quotes::record(const Book::Snapshot & snapshot, bool is_changed)
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					auto time = std::time(nullptr);
-
-					if (time > m_last_time)
+					if (is_changed || m_recorder.config().mode == Recorder::Mode::periodic)
 					{
-						std::fstream fout(m_path.string(), std::ios::app);
-
-						if (!fout)
-						{
-							throw quotes_exception("cannot open file " + m_path.string());
-						}
-
-						tm * time_info = std::localtime(&time); // !
-
-						static const auto delimeter = ',';
-
-						fout <<
-							std::setfill('0') << std::setw(4) << time_info->tm_year + 1900 <<
-							std::setfill('0') << std::setw(2) << time_info->tm_mon + 1 <<
-							std::setfill('0') << std::setw(2) << time_info->tm_mday << delimeter;
-
-						fout << 
-							std::setfill('0') << std::setw(2) << time_info->tm_hour <<
-							std::setfill('0') << std::setw(2) << time_info->tm_min <<
-							std::setfill('0') << std::setw(2) << time_info->tm_sec << delimeter;
-						
-						for (std::size_t i = 0; i < depth; ++i)
-						{
-							fout << 
-								m_asks.at(depth - 1 - i).first  << delimeter << 
-								m_asks.at(depth - 1 - i).second << delimeter;
-						}
-
-						for (std::size_t i = 0; i < depth; ++i)
-						{
-							fout << m_bids.at(i).first << delimeter << m_bids.at(i).second;
-
-							if (i != depth - 1)
-							{
-								fout << delimeter;
-							}
-						}
-
-						fout << std::endl;
-						
-						m_last_time = time;
+						m_recorder.push(m_channel, snapshot); // throttled by recorder
 					}
 				}
 				catch (const std::exception & exception)
@@ -8,20 +8,17 @@
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <exception>
-#include <fstream>
-#include <iomanip>
 #include <memory>
-#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <vector>
 
-#include <boost/filesystem.hpp>
 #include <boost/interprocess/allocators/allocator.hpp>
 #include <boost/interprocess/containers/deque.hpp>
 #include <boost/interprocess/containers/string.hpp>
@@ -29,13 +26,14 @@
 #include <boost/interprocess/sync/interprocess_mutex.hpp>
 #include <boost/interprocess/sync/named_mutex.hpp>
 #include <boost/interprocess/sync/scoped_lock.hpp>
-#include <boost/interprocess/managed_windows_shared_memory.hpp>
 
-#include <qluacpp/qlua>
-
-#include "../../config/config.hpp"
+#include "../provider/provider.hpp"
+#include "../recorder/recorder.hpp"
 
 #include "../../../../shared/source/logger/logger.hpp"
+#include "../../../../shared/source/market/book/book.hpp"
+#include "../../../../shared/source/market/directory/directory.hpp"
+#include "../../../../shared/source/market/telemetry/telemetry.hpp"
 
 namespace solution
 {
@@ -62,41 +60,25 @@ namespace solution
 			{
 			public:
 
-				using api_t = Config::api_t;
-
-			private:
-
 				using shared_memory_t = boost::interprocess::managed_shared_memory;
-				
-				using mutex_t = boost::interprocess::interprocess_mutex;
 
-				using price_t = double;
-
-				using volume_t = std::uint64_t;
+			private:
 
-				using orders_container_t = std::vector < std::pair < price_t, volume_t > > ;
+				using Book = shared::market::Book;
 
-				using path_t = boost::filesystem::path;
+				using Directory = shared::market::Directory;
 
-			private:
+			public:
 
-				struct Name
-				{
-					static inline const std::string total_ask = "total_ask";
-					static inline const std::string total_bid = "total_bid";
-				};
+				using Telemetry = shared::market::Telemetry;
 
 			private:
 
-				struct Extension
-				{
-					using extension_t = std::string;
+				using price_t = Provider::price_t;
 
-					static inline const extension_t txt = ".txt";
-					static inline const extension_t csv = ".csv";
+				using volume_t = Provider::volume_t;
 
-					static inline const extension_t empty = "";
-				};
+				using orders_container_t = Provider::orders_container_t;
 
 			public:
 
@@ -104,9 +86,10 @@ namespace solution
 					std::enable_if_t <
 						std::is_convertible_v < C, std::string > &&
 						std::is_convertible_v < A, std::string > > >
-				explicit Quotes(C && class_code, A && asset_code, const api_t & api) :
-					m_class_code(std::forward < C > (class_code)),
-					m_asset_code(std::forward < A > (asset_code)), m_api(api)
+				explicit Quotes(C && class_code, A && asset_code, Provider & provider,
+					shared_memory_t & shared_memory, Recorder & recorder, Telemetry & telemetry) :
+					m_class_code(std::forward < C > (class_code)), m_asset_code(std::forward < A > (asset_code)),
+					m_provider(provider), m_shared_memory(shared_memory), m_recorder(recorder), m_telemetry(telemetry)
 				{
 					initialize();
 				}
@@ -129,10 +112,6 @@ namespace solution
 
 				void uninitialize();
 
-			private:
-
-				std::string make_shared_memory_name() const;
-
 			public:
 
 				const auto & class_code() const noexcept
@@ -151,15 +130,19 @@ namespace solution
 
 			private:
 
-				void save() const;
+				void record(const Book::Snapshot & snapshot, bool is_changed);
 
 				void reset_orders();
 
-			private:
+				Book::Snapshot make_snapshot() const;
 
-				static inline const std::size_t depth = 20U;
+			public:
 
-				static inline const path_t directory = "quotes";
+				static inline const std::size_t diffs_size = 4096U;
+
+			private:
+
+				static inline const std::size_t depth = Book::depth;
 
 			private:
 
@@ -168,23 +151,28 @@ namespace solution
 
 			private:
 
-				api_t m_api;
+				Provider & m_provider;
 
-				shared_memory_t m_shared_memory;
+				shared_memory_t & m_shared_memory;
 
-				mutex_t * m_mutex;
+				Recorder & m_recorder;
 
-				volume_t * m_total_ask;
-				volume_t * m_total_bid;
+				Recorder::channel_t m_channel = 0;
 
-				orders_container_t m_asks;
-				orders_container_t m_bids;
+				Telemetry & m_telemetry;
 
-				path_t m_path;
+				Telemetry::Entry * m_entry = nullptr;
 
-			private:
+				Book::Header * m_header = nullptr;
+
+				Book::Diff * m_diffs = nullptr;
+
+				std::unique_ptr < Book > m_book;
 
-				mutable std::time_t m_last_time = 0;
+				Directory * m_directory = nullptr;
+
+				orders_container_t m_asks;
+				orders_container_t m_bids;
 			};
 
 		} // namespace market
@@ -0,0 +1,362 @@
+#include "recorder.hpp"
+
+namespace solution
+{
+	namespace plugin
+	{
+		namespace market
+		{
+			using Severity = shared::Logger::Severity;
+
+			void Recorder::initialize()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (m_config.capacity == 0 || m_config.throttle.count() < 0)
+					{
+						throw recorder_exception("invalid config");
+					}
+
+					boost::filesystem::create_directories(m_directory);
+
+					m_entries.reserve(m_config.capacity);
+					m_buffer .reserve(m_config.capacity);
+
+					m_thread = std::thread(&Recorder::run, this);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < recorder_exception > (logger, exception);
+				}
+			}
+
+			void Recorder::uninitialize()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					{
+						std::scoped_lock lock(m_mutex);
+
+						m_is_stopped = true;
+					}
+
+					m_condition.notify_one();
+
+					if (m_thread.joinable())
+					{
+						m_thread.join();
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < recorder_exception > (logger, exception);
+				}
+			}
+
+			Recorder::channel_t Recorder::add(const std::string & asset_code, Book::scale_t scale, Telemetry::Entry * telemetry)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto channel = std::make_unique < Channel > ();
+
+					channel->asset_code = asset_code;
+					channel->scale      = scale;
+					channel->telemetry  = telemetry;
+
+					std::scoped_lock lock(m_mutex);
+
+					m_channels.push_back(std::move(channel));
+
+					return m_channels.size() - 1;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < recorder_exception > (logger, exception);
+				}
+			}
+
+			void Recorder::push(channel_t channel, const Snapshot & snapshot)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					bool is_half_full = false;
+
+					{
+						std::scoped_lock lock(m_mutex);
+
+						auto & target = *m_channels.at(channel);
+
+						const auto throttle = std::chrono::duration_cast < std::chrono::nanoseconds > (m_config.throttle).count();
+
+						if (target.last_record != 0 && snapshot.monotonic - target.last_record < throttle)
+						{
+							target.held = snapshot;
+
+							target.is_held = true;
+
+							return;
+						}
+
+						append(target, snapshot);
+
+						is_half_full = (m_entries.size() == m_config.capacity / 2U + 1U);
+					}
+
+					if (is_half_full)
+					{
+						m_condition.notify_one();
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < recorder_exception > (logger, exception);
+				}
+			}
+
+			void Recorder::run()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					counter_t dropped = 0;
+
+					for (auto is_stopped = false; !is_stopped; )
+					{
+						{
+							std::unique_lock lock(m_mutex);
+
+							m_condition.wait_for(lock, flush_period, [this]()
+							{
+								return (m_is_stopped || m_entries.size() > m_config.capacity / 2U);
+							});
+
+							is_stopped = m_is_stopped;
+
+							release(is_stopped);
+
+							std::swap(m_entries, m_buffer);
+						}
+
+						try
+						{
+							write(m_buffer);
+						}
+						catch (const std::exception & exception)
+						{
+							logger.write(Severity::error, exception.what());
+						}
+
+						m_buffer.clear();
+
+						if (const auto total = m_dropped.load(std::memory_order_relaxed); total != dropped)
+						{
+							logger.write(Severity::error, std::to_string(total - dropped) + " book snapshots dropped");
+
+							dropped = total;
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < recorder_exception > (logger, exception);
+				}
+			}
+
+			void Recorder::append(Channel & channel, const Snapshot & snapshot)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					channel.last_record = snapshot.monotonic;
+
+					channel.is_held = false;
+
+					if (m_entries.size() == m_config.capacity)
+					{
+						m_dropped.fetch_add(1, std::memory_order_relaxed);
+
+						if (channel.telemetry)
+						{
+							Telemetry::add(channel.telemetry->dropped);
+						}
+
+						return;
+					}
+
+					m_entries.push_back(Entry { &channel, snapshot });
+
+					if (channel.telemetry)
+					{
+						Telemetry::add(channel.telemetry->pushed);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < recorder_exception > (logger, exception);
+				}
+			}
+
+			void Recorder::release(bool is_stopped)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto now = std::chrono::duration_cast < std::chrono::nanoseconds > (
+						std::chrono::steady_clock::now().time_since_epoch()).count();
+
+					const auto throttle = std::chrono::duration_cast < std::chrono::nanoseconds > (m_config.throttle).count();
+
+					for (const auto & channel : m_channels)
+					{
+						if (channel->is_held && (is_stopped || now - channel->last_record >= throttle))
+						{
+							append(*channel, channel->held);
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < recorder_exception > (logger, exception);
+				}
+			}
+
+			void Recorder::write(const entries_container_t & entries) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::vector < std::pair < Channel * , counter_t > > written; // each channel is flushed once
+
+					for (const auto & entry : entries)
+					{
+						auto & channel = *entry.channel;
+
+						if (const auto day = Record::day(entry.snapshot.timestamp); !channel.fout.is_open() || channel.day != day)
+						{
+							open(channel, day);
+						}
+
+						channel.fout.write(reinterpret_cast < const char * > (&entry.snapshot), sizeof(entry.snapshot));
+
+						auto iterator = std::find_if(std::begin(written), std::end(written),
+							[&channel](const auto & pair) { return (pair.first == &channel); });
+
+						if (iterator == std::end(written))
+						{
+							written.emplace_back(&channel, 1U);
+						}
+						else
+						{
+							++iterator->second;
+						}
+					}
+
+					for (const auto & [channel, size] : written)
+					{
+						if (!channel->fout.flush())
+						{
+							throw recorder_exception("cannot write book of " + channel->asset_code);
+						}
+
+						if (channel->telemetry)
+						{
+							Telemetry::add(channel->telemetry->popped, size);
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < recorder_exception > (logger, exception);
+				}
+			}
+
+			void Recorder::open(Channel & channel, Record::day_t day) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					channel.fout.close();
+
+					const auto path = Record::make_path(m_directory, channel.asset_code, day);
+
+					if (boost::filesystem::exists(path) && boost::filesystem::file_size(path) > 0)
+					{
+						std::ifstream fin(path.string(), std::ios::in | std::ios::binary);
+
+						Record::Header header;
+
+						if (!fin.read(reinterpret_cast < char * > (&header), sizeof(header)) || !Record::is_valid(header) ||
+							header.scale != channel.scale)
+						{
+							fin.close();
+
+							auto invalid_path = path; invalid_path += ".invalid";
+
+							boost::filesystem::rename(path, invalid_path); // keeps records of another version or scale
+
+							logger.write(Severity::error, "file " + path.string() + " renamed to " + invalid_path.string());
+						}
+						else
+						{
+							fin.close();
+
+							// a crash may leave a partial record, appending after it would
+							// shift every later record
+
+							const auto size = boost::filesystem::file_size(path);
+
+							const auto whole = sizeof(header) + (size - sizeof(header)) / sizeof(Snapshot) * sizeof(Snapshot);
+
+							if (whole != size)
+							{
+								boost::filesystem::resize_file(path, whole);
+
+								logger.write(Severity::error, "file " + path.string() + " truncated to " + std::to_string(whole) + " bytes");
+							}
+						}
+					}
+
+					const auto is_new = (!boost::filesystem::exists(path) || boost::filesystem::file_size(path) == 0);
+
+					channel.fout.open(path.string(), std::ios::out | std::ios::app | std::ios::binary);
+
+					if (!channel.fout)
+					{
+						throw recorder_exception("cannot open file " + path.string());
+					}
+
+					if (is_new)
+					{
+						Record::Header header;
+
+						header.scale = channel.scale;
+
+						channel.fout.write(reinterpret_cast < const char * > (&header), sizeof(header));
+					}
+
+					channel.day = day;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < recorder_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace plugin
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,250 @@
+#ifndef SOLUTION_PLUGIN_MARKET_RECORDER_HPP
+#define SOLUTION_PLUGIN_MARKET_RECORDER_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "../../../../shared/source/logger/logger.hpp"
+#include "../../../../shared/source/market/record/record.hpp"
+#include "../../../../shared/source/market/telemetry/telemetry.hpp"
+
+namespace solution
+{
+	namespace plugin
+	{
+		namespace market
+		{
+			class recorder_exception : public std::exception
+			{
+			public:
+
+				explicit recorder_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit recorder_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~recorder_exception() noexcept = default;
+			};
+
+			// writes order book snapshots of all assets to daily binary files in a
+			// background thread, push only copies the snapshot into a preallocated
+			// buffer, the writer swaps buffers once per flush period or when the
+			// buffer is half full, snapshots pushed into a full buffer are dropped,
+			// config tells producers which snapshots to push, a snapshot pushed
+			// within the throttle period of the last recorded one is held and the
+			// latest held snapshot is recorded by the writer once the period passes
+			// or on close, so the last change of a quiet book is not lost
+
+			class Recorder
+			{
+			public:
+
+				using Book = shared::market::Book;
+
+				using Record = shared::market::Record;
+
+				using Telemetry = shared::market::Telemetry;
+
+				using Snapshot = Record::Snapshot;
+
+				using path_t = Record::path_t;
+
+				using channel_t = std::size_t;
+
+				using counter_t = std::uint64_t;
+
+				using duration_t = std::chrono::milliseconds;
+
+			public:
+
+				enum class Mode
+				{
+					periodic, // last snapshot once per throttle period
+					change    // every changed snapshot, at most once per throttle period
+				};
+
+			public:
+
+				struct Config
+				{
+					Mode mode = Mode::periodic;
+
+					duration_t throttle = duration_t(1000);
+
+					std::size_t capacity = 8192U; // snapshots in each of two buffers
+				};
+
+			private:
+
+				struct Channel
+				{
+					std::string asset_code;
+
+					Book::scale_t scale = 0;
+
+					Telemetry::Entry * telemetry = nullptr; // of the producer, for popped and dropped counters
+
+					Record::day_t day = 0;
+
+					std::ofstream fout;
+
+					Record::timestamp_t last_record = 0; // monotonic, guarded by recorder mutex
+
+					Snapshot held; // guarded by recorder mutex
+
+					bool is_held = false;
+				};
+
+			private:
+
+				using channels_container_t = std::vector < std::unique_ptr < Channel > > ;
+
+			private:
+
+				struct Entry
+				{
+					Channel * channel = nullptr;
+
+					Snapshot snapshot;
+				};
+
+			private:
+
+				using entries_container_t = std::vector < Entry > ;
+
+			public:
+
+				explicit Recorder(const Config & config, const path_t & directory = default_directory) :
+					m_config(config), m_directory(directory), m_anchor(Record::make_anchor())
+				{
+					initialize();
+				}
+
+				~Recorder() noexcept
+				{
+					try
+					{
+						uninitialize();
+					}
+					catch (...)
+					{
+						// std::abort();
+					}
+				}
+
+			private:
+
+				Recorder			(const Recorder &) = delete;
+				Recorder & operator=(const Recorder &) = delete;
+
+			private:
+
+				void initialize();
+
+				void uninitialize();
+
+			public:
+
+				channel_t add(const std::string & asset_code, Book::scale_t scale, Telemetry::Entry * telemetry = nullptr);
+
+				void push(channel_t channel, const Snapshot & snapshot);
+
+			public:
+
+				const auto & config() const noexcept
+				{
+					return m_config;
+				}
+
+				const auto & anchor() const noexcept
+				{
+					return m_anchor;
+				}
+
+				auto dropped() const noexcept
+				{
+					return m_dropped.load(std::memory_order_relaxed);
+				}
+
+			private:
+
+				void run();
+
+				void append(Channel & channel, const Snapshot & snapshot);
+
+				void release(bool is_stopped);
+
+				void write(const entries_container_t & entries) const;
+
+				void open(Channel & channel, Record::day_t day) const;
+
+			public:
+
+				static inline const path_t default_directory = "quotes";
+
+			private:
+
+				static inline const std::chrono::milliseconds flush_period = std::chrono::milliseconds(1000);
+
+			private:
+
+				const Config m_config;
+
+				const path_t m_directory;
+
+				const Record::Anchor m_anchor;
+
+			private:
+
+				channels_container_t m_channels;
+
+				entries_container_t m_entries;
+
+				entries_container_t m_buffer; // owned by the writer thread
+
+			private:
+
+				std::mutex m_mutex;
+
+				std::condition_variable m_condition;
+
+				bool m_is_stopped = false;
+
+				std::atomic < counter_t > m_dropped { 0 };
+
+			private:
+
+				std::thread m_thread;
+			};
+
+		} // namespace market
+
+	} // namespace plugin
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_PLUGIN_MARKET_RECORDER_HPP
\ No newline at end of file
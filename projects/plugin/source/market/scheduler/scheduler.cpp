@@ -0,0 +1,170 @@
+#include "scheduler.hpp"
+
+namespace solution
+{
+	namespace plugin
+	{
+		namespace market
+		{
+			using Severity = shared::Logger::Severity;
+
+			void Scheduler::add(std::shared_ptr < Source > source)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto now = clock_t::now();
+
+					m_tasks.push_back(Task { std::move(source), now, now, m_config.live_period });
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+			void Scheduler::add(std::shared_ptr < Quotes > quotes)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_quotes_tasks.push_back(Quotes_Task { std::move(quotes), clock_t::now() });
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+			Scheduler::time_point_t Scheduler::run(time_point_t now)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto deadline = now + m_config.check_period;
+
+					for (auto & task : m_tasks)
+					{
+						try
+						{
+							if (now >= task.next_check)
+							{
+								check(task, now);
+							}
+							else if (now >= task.next_live)
+							{
+								live(task, now);
+							}
+						}
+						catch (...)
+						{
+							logger.write(Severity::error, task.source->asset_code() +
+								":" + task.source->scale_code() + " source update failed");
+
+							task.next_check = std::max(task.next_check, now + m_config.live_period);
+							task.next_live  = std::max(task.next_live,  now + m_config.live_period);
+						}
+
+						deadline = std::min({ deadline, task.next_check, task.next_live });
+					}
+
+					for (auto & task : m_quotes_tasks)
+					{
+						if (now >= task.next_poll)
+						{
+							poll(task, now);
+						}
+
+						deadline = std::min(deadline, task.next_poll);
+					}
+
+					return deadline;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+			void Scheduler::check(Task & task, time_point_t now)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					task.source->update();
+
+					++m_checks;
+
+					const auto time_to_close = std::chrono::duration_cast < duration_t > (task.source->time_to_close());
+
+					if (time_to_close.count() > 0)
+					{
+						task.retry_period = m_config.live_period;
+
+						task.next_check = now + std::min(time_to_close, m_config.check_period);
+					}
+					else
+					{
+						task.next_check = now + task.retry_period;
+
+						task.retry_period = std::min(task.retry_period * 2, m_config.check_period);
+					}
+
+					task.next_live = now + m_config.live_period;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+			void Scheduler::live(Task & task, time_point_t now)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (now - task.next_live >= m_config.live_period)
+					{
+						++m_lates; // a whole live period after it was due
+					}
+
+					task.source->update_last();
+
+					++m_lives;
+
+					task.next_live = now + m_config.live_period;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+			void Scheduler::poll(Quotes_Task & task, time_point_t now)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					task.quotes->update(); // errors are counted and logged by quotes
+
+					++m_polls;
+
+					task.next_poll = now + m_config.quotes_period;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace plugin
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,167 @@
+#ifndef SOLUTION_PLUGIN_MARKET_SCHEDULER_HPP
+#define SOLUTION_PLUGIN_MARKET_SCHEDULER_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../quotes/quotes.hpp"
+#include "../source/source.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace plugin
+	{
+		namespace market
+		{
+			class scheduler_exception : public std::exception
+			{
+			public:
+
+				explicit scheduler_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit scheduler_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~scheduler_exception() noexcept = default;
+			};
+
+			// plans polls of sources: the live candle is polled with live period,
+			// the size of a source is checked when its last candle should close
+			// and at least once per check period, after a missed close the check
+			// period is doubled from live period up to check period, level II
+			// quotes of assets are polled with quotes period
+
+			class Scheduler
+			{
+			public:
+
+				using clock_t = std::chrono::steady_clock;
+
+				using time_point_t = clock_t::time_point;
+
+				using duration_t = std::chrono::milliseconds;
+
+				using counter_t = std::uint64_t;
+
+			public:
+
+				struct Config
+				{
+					duration_t live_period  = duration_t(1000);
+					duration_t check_period = duration_t(60000);
+
+					duration_t quotes_period = duration_t(100);
+				};
+
+			private:
+
+				struct Task
+				{
+					std::shared_ptr < Source > source;
+
+					time_point_t next_check;
+					time_point_t next_live;
+
+					duration_t retry_period;
+				};
+
+				struct Quotes_Task
+				{
+					std::shared_ptr < Quotes > quotes;
+
+					time_point_t next_poll;
+				};
+
+			private:
+
+				using tasks_container_t = std::vector < Task > ;
+
+				using quotes_tasks_container_t = std::vector < Quotes_Task > ;
+
+			public:
+
+				explicit Scheduler(const Config & config) noexcept : m_config(config)
+				{}
+
+				~Scheduler() noexcept = default;
+
+			public:
+
+				void add(std::shared_ptr < Source > source);
+
+				void add(std::shared_ptr < Quotes > quotes);
+
+				time_point_t run(time_point_t now);
+
+			public:
+
+				const auto & checks() const noexcept
+				{
+					return m_checks;
+				}
+
+				const auto & lives() const noexcept
+				{
+					return m_lives;
+				}
+
+				const auto & lates() const noexcept
+				{
+					return m_lates;
+				}
+
+				const auto & polls() const noexcept
+				{
+					return m_polls;
+				}
+
+			private:
+
+				void check(Task & task, time_point_t now);
+
+				void live(Task & task, time_point_t now);
+
+				void poll(Quotes_Task & task, time_point_t now);
+
+			private:
+
+				const Config m_config;
+
+			private:
+
+				tasks_container_t m_tasks;
+
+				quotes_tasks_container_t m_quotes_tasks;
+
+			private:
+
+				counter_t m_checks = 0;
+				counter_t m_lives  = 0;
+				counter_t m_lates  = 0;
+				counter_t m_polls  = 0;
+			};
+
+		} // namespace market
+
+	} // namespace plugin
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_PLUGIN_MARKET_SCHEDULER_HPP
\ No newline at end of file
@@ -6,50 +6,35 @@ namespace solution
 	{
 		namespace market
 		{
-			void Source::initialize(const api_t & api)
+			void Source::initialize()
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					const auto timeframe = api.constant < unsigned int > (("INTERVAL_" + m_scale_code).c_str());
+					m_source = m_provider.make_series(m_class_code, m_asset_code, m_scale_code);
 
-					m_source = std::make_unique < source_t > (
-						api.CreateDataSource(m_class_code.c_str(), m_asset_code.c_str(), timeframe));
+					m_timeframe = m_provider.timeframe(m_scale_code);
 
-					const auto shared_memory_name = make_shared_memory_name();
+					m_header = m_shared_memory.construct < Candles::Header > (boost::interprocess::anonymous_instance) ();
+					m_buffer = m_shared_memory.construct < Candle > (boost::interprocess::anonymous_instance) [m_size] ();
 
-					const auto shared_memory_size = 65536U;
+					m_header->scale = m_provider.scale(m_class_code, m_asset_code);
 
-					boost::interprocess::shared_memory_object::remove(shared_memory_name.c_str());
+					m_candles = std::make_unique < Candles > (m_header, m_buffer, m_size);
 
-					m_shared_memory = shared_memory_t(boost::interprocess::create_only, 
-						shared_memory_name.c_str(), shared_memory_size);
+					m_directory = m_shared_memory.find < Directory > (boost::interprocess::unique_instance).first;
 
-					record_allocator_t allocator(m_shared_memory.get_segment_manager());
-
-					m_deque = m_shared_memory.construct < deque_t > (boost::interprocess::unique_instance) (allocator);
-					m_price = m_shared_memory.construct < price_t > (boost::interprocess::unique_instance) ();
-					m_mutex = m_shared_memory.construct < mutex_t > (boost::interprocess::unique_instance) ();
-				}
-				catch (const std::exception & exception)
-				{
-					shared::catch_handler < source_exception > (logger, exception);
-				}
-			}
-
-			void Source::uninitialize()
-			{
-				RUN_LOGGER(logger);
-
-				try
-				{
-					m_shared_memory.destroy_ptr(m_deque);
-					m_shared_memory.destroy_ptr(m_mutex);
+					if (!m_directory)
+					{
+						throw source_exception("directory not found");
+					}
 
-					const auto shared_memory_name = make_shared_memory_name();
+					m_directory->append(m_asset_code, m_scale_code,
+						m_shared_memory.get_handle_from_address(m_header),
+						m_shared_memory.get_handle_from_address(m_buffer), m_size);
 
-					boost::interprocess::shared_memory_object::remove(shared_memory_name.c_str());
+					m_entry = &m_telemetry.append(m_asset_code, m_scale_code);
 				}
 				catch (const std::exception & exception)
 				{
@@ -57,13 +42,14 @@ namespace solution
 				}
 			}
 
-			std::string Source::make_shared_memory_name() const
+			void Source::uninitialize()
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					return "QUIK_" + m_asset_code + "_" + m_scale_code;
+					m_shared_memory.destroy_ptr(m_header);
+					m_shared_memory.destroy_ptr(m_buffer);
 				}
 				catch (const std::exception & exception)
 				{
@@ -75,102 +61,130 @@ namespace solution
 			{
 				RUN_LOGGER(logger);
 
+				const auto start = std::chrono::steady_clock::now();
+
 				try
 				{
-					const auto size = m_source->Size();
+					Telemetry::add(m_entry->calls);
+
+					const auto size = m_source->size();
 
+					if (size == 0)
 					{
-						boost::interprocess::scoped_lock < mutex_t > lock(*m_mutex);
+						Telemetry::complete(*m_entry, std::chrono::steady_clock::now() - start);
 
-						*m_price = make_candle(size).price_close;
+						return;
 					}
 
-					if (size >= m_size)
+					const auto first_index = (size > m_size ? size - m_size + 1 : 1U);
+
+					auto index = std::min(std::max(m_last_index, first_index), size);
+
+					std::vector < Candle > candles;
+
+					candles.reserve(std::min(size - index, fill_size) + 1);
+
+					// deep history is published in batches, so that readers do not
+					// have to retry behind one long write during the initial fill,
+					// the price stays the previous one until the last batch
+
+					const auto price = m_candles->price();
+
+					while (size - index > fill_size)
 					{
-						if (m_deque->size() == 0)
+						candles.clear();
+
+						for (const auto last = index + fill_size; index < last; ++index)
 						{
-							boost::interprocess::scoped_lock < mutex_t > lock(*m_mutex);
+							candles.push_back(m_source->candle(index));
+						}
 
-							for (index_t index = size - m_size + 1; index <= size; ++index)
-							{
-								m_deque->push_back(make_record(make_candle(index)));
+						m_candles->publish(std::begin(candles), std::end(candles), price);
 
-								m_last_index = index;
-							}
-						}
+						Telemetry::add(m_entry->calls,  candles.size());
+						Telemetry::add(m_entry->pushed, candles.size());
+					}
 
-						if (m_last_index < size)
-						{
-							auto delta = std::min(size - m_last_index, m_size);
+					candles.clear();
 
-							boost::interprocess::scoped_lock < mutex_t > lock(*m_mutex);
+					for (; index < size; ++index)
+					{
+						candles.push_back(m_source->candle(index));
+					}
 
-							for (index_t index = std::max(size - m_size + 1, m_last_index + 1); index <= size; ++index)
-							{
-								m_deque->push_back(make_record(make_candle(index)));
+					candles.push_back(m_source->candle(size));
 
-								m_last_index = index;
-							}
+					if (std::size(candles) > 1 || is_changed(candles.back(), m_last_candle))
+					{
+						m_candles->publish(std::begin(candles), std::end(candles), candles.back().price_close);
 
-							for (index_t index = 0; index < delta; ++index)
-							{
-								m_deque->pop_front();
-							}
-						}
-						else
-						{
-							boost::interprocess::scoped_lock < mutex_t > lock(*m_mutex);
+						Telemetry::add(m_entry->calls,  candles.size());
+						Telemetry::add(m_entry->pushed, candles.size());
 
-							m_deque->pop_back();
+						m_directory->event().notify();
+					}
 
-							m_deque->push_back(make_record(make_candle(size)));
-						}
+					if (m_last_index < size)
+					{
+						m_candles->event().notify();
 					}
+
+					m_last_index = size;
+
+					m_last_time = m_provider.make_time(candles.back());
+
+					m_last_candle = candles.back();
+
+					Telemetry::complete(*m_entry, std::chrono::steady_clock::now() - start);
 				}
 				catch (const std::exception & exception)
 				{
+					Telemetry::add(m_entry->errors);
+
 					shared::catch_handler < source_exception > (logger, exception);
 				}
 			}
 
-			Source::Candle Source::make_candle(index_t index) const
+			void Source::update_last() const
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					Candle candle;
+					if (m_last_index == 0)
+					{
+						update();
 
-					candle.index = index;
+						return;
+					}
 
-					std::stringstream stream;
+					const auto start = std::chrono::steady_clock::now();
 
-					auto time = m_source->T(index);
+					try
+					{
+						Telemetry::add(m_entry->calls);
 
-					stream <<
-						std::setfill('0') << std::setw(4) << time.year  <<
-						std::setfill('0') << std::setw(2) << time.month <<
-						std::setfill('0') << std::setw(2) << time.day;
-						
-					stream >> candle.date;
+						const auto candle = m_source->candle(m_last_index);
 
-					stream.clear();
+						if (is_changed(candle, m_last_candle)) // unchanged candles keep the sequence, readers see no updates
+						{
+							m_candles->publish(&candle, &candle + 1, candle.price_close);
 
-					stream <<
-						std::setfill('0') << std::setw(2) << time.hour <<
-						std::setfill('0') << std::setw(2) << time.min  <<
-						std::setfill('0') << std::setw(2) << time.sec;
+							Telemetry::add(m_entry->pushed);
 
-					stream >> candle.time;
+							m_directory->event().notify();
 
-					candle.price_open  = m_source->O(index);
-					candle.price_high  = m_source->H(index);
-					candle.price_low   = m_source->L(index);
-					candle.price_close = m_source->C(index);
+							m_last_candle = candle;
+						}
 
-					candle.volume = static_cast < Candle::volume_t > (m_source->V(index));
+						Telemetry::complete(*m_entry, std::chrono::steady_clock::now() - start);
+					}
+					catch (...)
+					{
+						Telemetry::add(m_entry->errors);
 
-					return candle;
+						throw;
+					}
 				}
 				catch (const std::exception & exception)
 				{
@@ -178,26 +192,31 @@ namespace solution
 				}
 			}
 
-			Source::record_t Source::make_record(const Candle & candle) const
+			bool Source::is_changed(const Candle & candle, const Candle & last_candle) noexcept
+			{
+				return (
+					candle.index       != last_candle.index       ||
+					candle.date        != last_candle.date        ||
+					candle.time        != last_candle.time        ||
+					candle.price_open  != last_candle.price_open  ||
+					candle.price_high  != last_candle.price_high  ||
+					candle.price_low   != last_candle.price_low   ||
+					candle.price_close != last_candle.price_close ||
+					candle.volume      != last_candle.volume);
+			}
+
+			Source::timeframe_t Source::time_to_close() const
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					static const char delimeter = ',';
-
-					std::stringstream sout;
-
-					sout << std::setprecision(6) << std::fixed <<
-						candle.date        << delimeter <<
-						candle.time        << delimeter <<
-						candle.price_open  << delimeter <<
-						candle.price_high  << delimeter <<
-						candle.price_low   << delimeter <<
-						candle.price_close << delimeter <<
-						candle.volume;
+					if (m_last_time == 0 || m_timeframe.count() == 0)
+					{
+						return timeframe_t(0);
+					}
 
-					return record_t(sout.str().c_str(), m_shared_memory.get_segment_manager());
+					return m_provider.duration_until(m_last_time + m_timeframe.count());
 				}
 				catch (const std::exception & exception)
 				{
@@ -8,7 +8,9 @@
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <ctime>
 #include <exception>
 #include <fstream>
 #include <iomanip>
@@ -17,22 +19,17 @@
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <boost/filesystem.hpp>
-#include <boost/interprocess/allocators/allocator.hpp>
-#include <boost/interprocess/containers/deque.hpp>
-#include <boost/interprocess/containers/string.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
-#include <boost/interprocess/sync/interprocess_mutex.hpp>
-#include <boost/interprocess/sync/named_mutex.hpp>
-#include <boost/interprocess/sync/scoped_lock.hpp>
-#include <boost/interprocess/managed_windows_shared_memory.hpp>
 
-#include <qluacpp/qlua>
-
-#include "../../config/config.hpp"
+#include "../provider/provider.hpp"
 
 #include "../../../../shared/source/logger/logger.hpp"
+#include "../../../../shared/source/market/candles/candles.hpp"
+#include "../../../../shared/source/market/directory/directory.hpp"
+#include "../../../../shared/source/market/telemetry/telemetry.hpp"
 
 namespace solution
 {
@@ -59,56 +56,29 @@ namespace solution
 			{
 			public:
 
-				using api_t = Config::api_t;
-
-			private:
-
-				using source_t = qlua::data_source;
-
 				using shared_memory_t = boost::interprocess::managed_shared_memory;
 
-				using record_t = 
-				    boost::interprocess::basic_string < char, std::char_traits < char > ,
-					    boost::interprocess::allocator < char, shared_memory_t::segment_manager > > ;
-
-				using record_allocator_t = 
-					boost::interprocess::allocator < record_t, shared_memory_t::segment_manager > ;
-
-				using deque_t = boost::interprocess::deque < record_t, record_allocator_t > ;
-
-				using mutex_t = boost::interprocess::interprocess_mutex;
-
 			private:
 
-				struct Candle
-				{
-					using index_t = std::size_t;
+				using Candle = shared::market::Candle;
 
-					using date_t = std::string;
-					using time_t = std::string;
+				using Candles = shared::market::Candles;
 
-					using price_t = double;
+				using Directory = shared::market::Directory;
 
-					using volume_t = std::uint64_t;
-
-					index_t index = 0;
-
-					date_t date;
-					time_t time;
-
-					price_t price_open = 0.0;
-					price_t price_high = 0.0;
-					price_t price_low = 0.0;
-					price_t price_close = 0.0;
+			public:
 
-					volume_t volume = 0;
-				};
+				using Telemetry = shared::market::Telemetry;
 
 			private:
 
 				using price_t = Candle::price_t;
 				using index_t = Candle::index_t;
 
+			public:
+
+				using timeframe_t = Provider::timeframe_t;
+
 			public:
 
 				template < typename C, typename A, typename S, typename Enable =
@@ -116,13 +86,14 @@ namespace solution
 						std::is_convertible_v < C, std::string > &&
 						std::is_convertible_v < A, std::string > &&
 						std::is_convertible_v < S, std::string > > >
-				explicit Source(const api_t & api, C && class_code, A && asset_code, S && scale_code, 
-					std::size_t size = default_size) :
+				explicit Source(Provider & provider, shared_memory_t & shared_memory, Telemetry & telemetry,
+					C && class_code, A && asset_code, S && scale_code, std::size_t size = default_size) :
 						m_class_code(std::forward < C > (class_code)),
 						m_asset_code(std::forward < A > (asset_code)), 
-						m_scale_code(std::forward < S > (scale_code)), m_size(size)
+						m_scale_code(std::forward < S > (scale_code)), m_size(size),
+						m_provider(provider), m_shared_memory(shared_memory), m_telemetry(telemetry)
 				{
-					initialize(api);
+					initialize();
 				}
 
 				~Source() noexcept
@@ -139,14 +110,10 @@ namespace solution
 
 			private:
 
-				void initialize(const api_t & api);
+				void initialize();
 
 				void uninitialize();
 
-			private:
-
-				std::string make_shared_memory_name() const;
-
 			public:
 
 				const auto & class_code() const noexcept
@@ -164,19 +131,30 @@ namespace solution
 					return m_scale_code;
 				}
 
+				const auto & timeframe() const noexcept
+				{
+					return m_timeframe;
+				}
+
 			public:
 
 				void update() const;
 
+				void update_last() const;
+
+				timeframe_t time_to_close() const;
+
 			private:
 
-				Candle make_candle(index_t index) const;
+				static bool is_changed(const Candle & candle, const Candle & last_candle) noexcept;
 
-				record_t make_record(const Candle & candle) const;
+			public:
+
+				static inline const std::size_t default_size = 250U;
 
 			private:
 
-				static inline const std::size_t default_size = 250U;
+				static inline const std::size_t fill_size = 1000U;
 
 			private:
 
@@ -186,19 +164,35 @@ namespace solution
 
 				const std::size_t m_size = default_size;
 
+				timeframe_t m_timeframe;
+
 			private:
 
-				std::unique_ptr < source_t > m_source;
+				Provider & m_provider;
+
+				std::unique_ptr < Provider::Series > m_source;
+
+				shared_memory_t & m_shared_memory;
+
+				Candles::Header * m_header = nullptr;
+
+				Candle * m_buffer = nullptr;
 
-				shared_memory_t m_shared_memory;
+				std::unique_ptr < Candles > m_candles;
 
-				deque_t * m_deque;
-				price_t * m_price;
-				mutex_t * m_mutex;
+				Directory * m_directory = nullptr;
+
+				Telemetry & m_telemetry;
+
+				Telemetry::Entry * m_entry = nullptr;
 
 			private:
 
 				mutable index_t m_last_index = 0;
+
+				mutable std::time_t m_last_time = 0;
+
+				mutable Candle m_last_candle; // as last published
 			};
 
 		} // namespace market
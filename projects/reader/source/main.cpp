@@ -0,0 +1,272 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/managed_shared_memory.hpp>
+
+#include "../../shared/source/logger/logger.hpp"
+#include "../../shared/source/market/record/record.hpp"
+#include "../../shared/source/market/telemetry/telemetry.hpp"
+
+using Logger = solution::shared::Logger;
+
+using Price  = solution::shared::market::Price;
+using Record = solution::shared::market::Record;
+using Reader = solution::shared::market::Reader;
+
+using Telemetry = solution::shared::market::Telemetry;
+
+using Snapshot = Record::Snapshot;
+
+using path_t = Record::path_t;
+
+std::string make_time(Record::timestamp_t timestamp) // hhmmss of UTC day
+{
+	const auto seconds = static_cast < int > ((timestamp - Record::day(timestamp) * Record::nanoseconds_per_day) / 1000000000LL);
+
+	char buffer[16];
+
+	std::snprintf(buffer, sizeof(buffer), "%02d%02d%02d", seconds / 3600, seconds / 60 % 60, seconds % 60);
+
+	return buffer;
+}
+
+void print_summary(const path_t & path)
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		Reader reader(path);
+
+		Snapshot snapshot, first_snapshot;
+
+		while (reader.next(snapshot))
+		{
+			if (reader.size() == 1)
+			{
+				first_snapshot = snapshot;
+			}
+		}
+
+		std::cout << path.string() << ": " << reader.size() << " snapshots" << std::endl;
+
+		if (reader.size() > 0)
+		{
+			std::cout <<
+				"first: " << Record::date(Record::day(first_snapshot.timestamp)) << " " << make_time(first_snapshot.timestamp) <<
+				" sequence " << first_snapshot.sequence << std::endl <<
+				"last:  " << Record::date(Record::day(snapshot.timestamp)) << " " << make_time(snapshot.timestamp) <<
+				" sequence " << snapshot.sequence << std::endl <<
+				"span:  " << (snapshot.monotonic - first_snapshot.monotonic) / 1000000LL << " ms" << std::endl <<
+				"best:  " << Price::to_string(snapshot.bids[0].price, reader.scale()) << " x " << snapshot.bids[0].volume << " / " <<
+				Price::to_string(snapshot.asks[0].price, reader.scale()) << " x " << snapshot.asks[0].volume << std::endl;
+		}
+	}
+	catch (const std::exception & exception)
+	{
+		solution::shared::catch_handler < std::runtime_error > (logger, exception);
+	}
+}
+
+// one line per snapshot: wall and monotonic timestamps in nanoseconds, UTC
+// date and time, asks from the farthest level to the best one, then bids from
+// the best level to the farthest one, as price and volume pairs
+
+void convert_to_csv(const path_t & path, const path_t & csv_path)
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		Reader reader(path);
+
+		std::ofstream fout(csv_path.string(), std::ios::out);
+
+		if (!fout)
+		{
+			throw std::runtime_error("cannot open file " + csv_path.string());
+		}
+
+		static const auto separator = ',';
+
+		const auto depth = std::size(Snapshot().asks);
+
+		fout << "timestamp" << separator << "monotonic" << separator << "date" << separator << "time";
+
+		for (std::size_t i = 0; i < depth; ++i)
+		{
+			fout << separator << "ask_price_" << depth - i << separator << "ask_volume_" << depth - i;
+		}
+
+		for (std::size_t i = 0; i < depth; ++i)
+		{
+			fout << separator << "bid_price_" << i + 1 << separator << "bid_volume_" << i + 1;
+		}
+
+		fout << '\n';
+
+		Snapshot snapshot;
+
+		while (reader.next(snapshot))
+		{
+			fout <<
+				snapshot.timestamp << separator <<
+				snapshot.monotonic << separator <<
+				Record::date(Record::day(snapshot.timestamp)) << separator <<
+				make_time(snapshot.timestamp);
+
+			for (std::size_t i = 0; i < depth; ++i)
+			{
+				fout << separator << Price::to_string(snapshot.asks[depth - 1 - i].price, reader.scale()) << separator << snapshot.asks[depth - 1 - i].volume;
+			}
+
+			for (std::size_t i = 0; i < depth; ++i)
+			{
+				fout << separator << Price::to_string(snapshot.bids[i].price, reader.scale()) << separator << snapshot.bids[i].volume;
+			}
+
+			fout << '\n';
+		}
+
+		if (!fout.flush())
+		{
+			throw std::runtime_error("cannot write file " + csv_path.string());
+		}
+
+		std::cout << csv_path.string() << ": " << reader.size() << " snapshots" << std::endl;
+	}
+	catch (const std::exception & exception)
+	{
+		solution::shared::catch_handler < std::runtime_error > (logger, exception);
+	}
+}
+
+// one line per producer of the running plugin: update, error, provider call
+// and record counters, age of the last successful update and the upper bound
+// of the median and of the slowest update duration
+
+void print_telemetry()
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		boost::interprocess::managed_shared_memory shared_memory(
+			boost::interprocess::open_read_only, Telemetry::Name::segment.c_str());
+
+		const auto telemetry = shared_memory.find < Telemetry > (boost::interprocess::unique_instance).first;
+
+		if (!telemetry)
+		{
+			throw std::runtime_error("telemetry not found");
+		}
+
+		const auto now = std::chrono::duration_cast < Telemetry::duration_t > (
+			std::chrono::system_clock::now().time_since_epoch()).count();
+
+		auto upper_bound = [](std::size_t bucket) // microseconds
+		{
+			return (Telemetry::counter_t(1) << bucket);
+		};
+
+		for (std::size_t index = 0; index < telemetry->size(); ++index)
+		{
+			const auto & entry = telemetry->at(index);
+
+			const auto updates = entry.updates.load(std::memory_order_relaxed);
+
+			std::size_t median = 0, slowest = 0;
+
+			for (std::size_t bucket = 0, count = 0; bucket < Telemetry::buckets; ++bucket)
+			{
+				if (const auto size = entry.durations[bucket].load(std::memory_order_relaxed); size > 0)
+				{
+					if (count < (updates + 1U) / 2U)
+					{
+						median = bucket;
+					}
+
+					count += size;
+
+					slowest = bucket;
+				}
+			}
+
+			const auto last_update = entry.last_update.load(std::memory_order_relaxed);
+
+			std::cout << entry.asset_code << ":" << entry.scale_code <<
+				" updates " << updates <<
+				" errors "  << entry.errors .load(std::memory_order_relaxed) <<
+				" calls "   << entry.calls  .load(std::memory_order_relaxed) <<
+				" pushed "  << entry.pushed .load(std::memory_order_relaxed) <<
+				" popped "  << entry.popped .load(std::memory_order_relaxed) <<
+				" dropped " << entry.dropped.load(std::memory_order_relaxed) <<
+				" age "     << (last_update == 0 ? -1 : (now - last_update) / 1000000LL) << " ms" <<
+				" median < " << upper_bound(median) << " us" <<
+				" slowest < " << upper_bound(slowest) << " us" << std::endl;
+		}
+	}
+	catch (const std::exception & exception)
+	{
+		solution::shared::catch_handler < std::runtime_error > (logger, exception);
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		if (argc < 2)
+		{
+			std::cout << "usage: reader <file" << Record::Extension::book << "> [--csv [<file" << Record::Extension::csv << ">]] | --telemetry" << std::endl;
+
+			return EXIT_FAILURE;
+		}
+
+		if (std::string(argv[1]) == "--telemetry")
+		{
+			print_telemetry();
+
+			return EXIT_SUCCESS;
+		}
+
+		path_t path = argv[1];
+
+		if (argc > 2 && std::string(argv[2]) == "--csv")
+		{
+			auto csv_path = (argc > 3 ? path_t(argv[3]) : path_t(path).replace_extension(Record::Extension::csv));
+
+			convert_to_csv(path, csv_path);
+		}
+		else
+		{
+			print_summary(path);
+		}
+
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception & exception)
+	{
+		logger.write(Logger::Severity::fatal, exception.what());
+
+		return EXIT_FAILURE;
+	}
+	catch (...)
+	{
+		logger.write(Logger::Severity::fatal, "unknown exception");
+
+		return EXIT_FAILURE;
+	}
+}
\ No newline at end of file
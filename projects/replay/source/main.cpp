@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "../../plugin/source/market/market.hpp"
+#include "../../plugin/source/market/provider/replay/replay.hpp"
+
+#include "../../shared/source/logger/logger.hpp"
+
+using Logger = solution::shared::Logger;
+
+using Market = solution::plugin::Market;
+
+using Replay = solution::plugin::market::Replay;
+
+// runs the market of the plugin outside the terminal on recorded files, so
+// actions, trader and reader can be run against a replay of a session
+
+int main(int argc, char * argv[])
+{
+	RUN_LOGGER(logger);
+
+	try
+	{
+		const auto speed = (argc > 1 ? static_cast < Replay::speed_t > (std::stod(argv[1])) : Replay::default_speed);
+
+		const auto directory = (argc > 2 ? Replay::path_t(argv[2]) : Replay::default_directory);
+
+		const auto utc_offset = (argc > 3 ? std::chrono::duration_cast < Replay::timeframe_t > (
+			std::chrono::hours(std::stoi(argv[3]))) : Replay::default_utc_offset); // of exchange times in candles
+
+		if (speed <= 0.0)
+		{
+			std::cout << "usage: replay [<speed> [<directory> [<utc offset in hours>]]]" << std::endl;
+
+			return EXIT_FAILURE;
+		}
+
+		Market market(std::make_shared < Replay > (speed, directory, utc_offset));
+
+		std::thread thread([&market]() { market.run(); });
+
+		std::cout << "replay of " << directory.string() << " at speed " << speed << ", press enter to stop" << std::endl;
+
+		std::cin.get();
+
+		market.stop();
+
+		thread.join();
+
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception & exception)
+	{
+		logger.write(Logger::Severity::fatal, exception.what());
+
+		return EXIT_FAILURE;
+	}
+	catch (...)
+	{
+		logger.write(Logger::Severity::fatal, "unknown exception");
+
+		return EXIT_FAILURE;
+	}
+}
\ No newline at end of file
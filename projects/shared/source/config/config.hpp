@@ -7,6 +7,7 @@
 #  pragma once
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -17,6 +18,10 @@ namespace solution
 		struct Config
 		{
 			using words_container_t = std::vector < std::string > ;
+
+			using id_t = std::uint32_t; // of an interned word
+
+			using ids_container_t = std::vector < id_t > ;
 		};
 
 	} // namespace shared
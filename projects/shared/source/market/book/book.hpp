@@ -0,0 +1,475 @@
+#ifndef SOLUTION_SHARED_MARKET_BOOK_HPP
+#define SOLUTION_SHARED_MARKET_BOOK_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../event/event.hpp"
+#include "../price/price.hpp"
+#include "../seqlock/seqlock.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace market
+		{
+			// top of the level II book placed in shared memory, writer fills the
+			// buffer readers are not directed to and then switches the index, each
+			// buffer is guarded by its own seqlock, so readers get a consistent
+			// snapshot without locking and retry only when they are a whole update
+			// behind the writer, changed levels of each snapshot are appended to a
+			// ring of diffs, so readers can keep their own book up to date, features
+			// derived from a snapshot are published together with it
+
+			class Book
+			{
+			public:
+
+				using price_t = Price::ticks_t;
+
+				using scale_t = Price::scale_t;
+
+				using volume_t = std::uint64_t;
+
+				using sequence_t = std::uint64_t;
+
+				using timestamp_t = std::int64_t; // nanoseconds since epoch
+
+			public:
+
+				static constexpr std::size_t depth = 20U;
+
+				static constexpr std::size_t bands = 4U;
+
+				static constexpr std::size_t band_levels[bands] = { 1U, 5U, 10U, depth }; // of imbalance
+
+				static constexpr price_t band_steps[bands] = { 10, 50, 100, 500 }; // of cumulative depth from the best price
+
+			public:
+
+				struct Level
+				{
+					price_t price = 0;
+
+					volume_t volume = 0;
+				};
+
+			public:
+
+				struct Snapshot
+				{
+					sequence_t sequence = 0;
+
+					timestamp_t timestamp = 0;
+					timestamp_t monotonic = 0; // steady clock nanoseconds of the same moment
+
+					Level asks[depth] = {}; // from the best ask upwards
+					Level bids[depth] = {}; // from the best bid downwards
+
+					volume_t total_ask = 0; // of the depth levels
+					volume_t total_bid = 0;
+				};
+
+				static_assert(std::is_trivially_copyable_v < Snapshot > , "Snapshot is not trivially copyable");
+
+			public:
+
+				struct Features // prices in ticks, zero when a side of the book is empty
+				{
+					sequence_t sequence = 0; // of the snapshot the features belong to
+
+					price_t spread = 0;
+
+					double mid          = 0.0;
+					double weighted_mid = 0.0; // mean of volume weighted ask and bid prices
+					double microprice   = 0.0; // best prices weighted by volumes of the opposite side
+
+					double imbalance[bands] = {}; // (bid - ask) / (bid + ask) volume of band levels
+
+					volume_t ask_depth[bands] = {}; // volume within band steps of price from the best price
+					volume_t bid_depth[bands] = {};
+				};
+
+				static_assert(std::is_trivially_copyable_v < Features > , "Features is not trivially copyable");
+
+			public:
+
+				enum class Side : std::uint8_t
+				{
+					ask,
+					bid
+				};
+
+			public:
+
+				struct Diff
+				{
+					sequence_t sequence = 0; // of the snapshot the diff belongs to
+
+					Side side = Side::ask;
+
+					std::uint8_t level = 0;
+
+					Level value;
+				};
+
+				static_assert(std::is_trivially_copyable_v < Diff > , "Diff is not trivially copyable");
+
+			public:
+
+				using diffs_container_t = std::vector < Diff > ;
+
+			private:
+
+				struct Ring
+				{
+					Seqlock seqlock;
+
+					std::uint64_t size = 0;
+
+					sequence_t first_sequence = 1; // first snapshot with all its diffs in the ring
+					sequence_t last_sequence  = 0;
+
+					timestamp_t timestamp = 0; // of the last snapshot, since diffs carry no time
+					timestamp_t monotonic = 0;
+				};
+
+			private:
+
+				struct Buffer
+				{
+					Seqlock seqlock;
+
+					Snapshot snapshot;
+
+					Features features;
+				};
+
+			public:
+
+				struct Header
+				{
+					Event event;
+
+					scale_t scale = 0; // of prices, set once by the writer
+
+					price_t step = 1; // minimum change of prices in ticks, set once by the writer
+
+					std::atomic < std::uint64_t > index { 0 };
+
+					Buffer buffers[2];
+
+					Ring ring;
+				};
+
+			public:
+
+				explicit Book(Header * header, Diff * diffs, std::size_t capacity) noexcept :
+					m_header(header), m_diffs(diffs), m_capacity(capacity)
+				{}
+
+				~Book() noexcept = default;
+
+			public:
+
+				auto capacity() const noexcept
+				{
+					return m_capacity;
+				}
+
+				auto & event() const noexcept
+				{
+					return m_header->event;
+				}
+
+				auto scale() const noexcept
+				{
+					return m_header->scale;
+				}
+
+				auto step() const noexcept
+				{
+					return m_header->step;
+				}
+
+			public:
+
+				void publish(const Snapshot & snapshot, const Features & features) noexcept
+				{
+					const auto index = m_header->index.load(std::memory_order_relaxed);
+
+					const auto & previous = m_header->buffers[index & 1U].snapshot;
+
+					const auto sequence = previous.sequence;
+
+					{
+						std::scoped_lock < Seqlock > lock(m_header->ring.seqlock);
+
+						for (std::size_t level = 0; level < depth; ++level)
+						{
+							if (snapshot.asks[level].price  != previous.asks[level].price || 
+								snapshot.asks[level].volume != previous.asks[level].volume)
+							{
+								push(Diff { sequence + 1U, Side::ask, static_cast < std::uint8_t > (level), snapshot.asks[level] });
+							}
+
+							if (snapshot.bids[level].price  != previous.bids[level].price || 
+								snapshot.bids[level].volume != previous.bids[level].volume)
+							{
+								push(Diff { sequence + 1U, Side::bid, static_cast < std::uint8_t > (level), snapshot.bids[level] });
+							}
+						}
+
+						m_header->ring.last_sequence = sequence + 1U;
+
+						m_header->ring.timestamp = snapshot.timestamp;
+						m_header->ring.monotonic = snapshot.monotonic;
+					}
+
+					auto & buffer = m_header->buffers[(index + 1U) & 1U];
+
+					{
+						std::scoped_lock < Seqlock > lock(buffer.seqlock);
+
+						buffer.snapshot = snapshot;
+						buffer.features = features;
+
+						buffer.snapshot.sequence = sequence + 1U;
+						buffer.features.sequence = sequence + 1U;
+					}
+
+					m_header->index.store(index + 1U, std::memory_order_release);
+				}
+
+				Snapshot get() const noexcept
+				{
+					const auto & buffer = m_header->buffers[m_header->index.load(std::memory_order_acquire) & 1U];
+
+					return buffer.seqlock.read([&buffer]() noexcept
+					{
+						return buffer.snapshot;
+					});
+				}
+
+				Features features() const noexcept
+				{
+					const auto & buffer = m_header->buffers[m_header->index.load(std::memory_order_acquire) & 1U];
+
+					return buffer.seqlock.read([&buffer]() noexcept
+					{
+						return buffer.features;
+					});
+				}
+
+				// snapshot and features of the same sequence, read from one buffer at once
+
+				void get(Snapshot & snapshot, Features & features) const noexcept
+				{
+					const auto & buffer = m_header->buffers[m_header->index.load(std::memory_order_acquire) & 1U];
+
+					std::tie(snapshot, features) = buffer.seqlock.read([&buffer]() noexcept
+					{
+						return std::make_pair(buffer.snapshot, buffer.features);
+					});
+				}
+
+				// brings the snapshot to the last published one by the diffs after its
+				// sequence, time included, returns false and leaves the snapshot as it
+				// was when some of them have already been overwritten and the reader
+				// has to start again from a snapshot
+
+				bool update(Snapshot & snapshot) const
+				{
+					diffs_container_t diffs;
+
+					sequence_t last_sequence = 0;
+
+					timestamp_t timestamp = 0;
+					timestamp_t monotonic = 0;
+
+					const auto sequence = snapshot.sequence;
+
+					const auto is_complete = m_header->ring.seqlock.read(
+						[this, sequence, &last_sequence, &timestamp, &monotonic, &diffs]()
+					{
+						diffs.clear();
+
+						const auto & ring = m_header->ring;
+
+						last_sequence = ring.last_sequence;
+
+						timestamp = ring.timestamp;
+						monotonic = ring.monotonic;
+
+						if (sequence + 1U < ring.first_sequence || sequence > ring.last_sequence)
+						{
+							return false;
+						}
+
+						for (auto size = ring.size; size > 0 && ring.size - size < m_capacity; --size)
+						{
+							const auto & diff = m_diffs[(size - 1U) % m_capacity];
+
+							if (diff.sequence <= sequence)
+							{
+								break;
+							}
+
+							diffs.push_back(diff);
+						}
+
+						return true;
+					});
+
+					if (!is_complete)
+					{
+						return false;
+					}
+
+					std::for_each(std::rbegin(diffs), std::rend(diffs), [&snapshot](const auto & diff)
+					{
+						apply(snapshot, diff);
+					});
+
+					snapshot.sequence = last_sequence;
+
+					if (last_sequence != sequence)
+					{
+						snapshot.timestamp = timestamp;
+						snapshot.monotonic = monotonic;
+					}
+
+					return true;
+				}
+
+			public:
+
+				static void apply(Snapshot & snapshot, const Diff & diff) noexcept
+				{
+					auto & level = (diff.side == Side::ask ? snapshot.asks : snapshot.bids)[diff.level];
+
+					auto & total = (diff.side == Side::ask ? snapshot.total_ask : snapshot.total_bid);
+
+					total = total - level.volume + diff.value.volume;
+
+					level = diff.value;
+
+					snapshot.sequence = diff.sequence;
+				}
+
+				// depth bands are measured in steps of the instrument, so that they
+				// cover the same part of the book whatever the scale of prices is
+
+				static Features make_features(const Snapshot & snapshot, price_t step = 1) noexcept
+				{
+					Features features;
+
+					features.sequence = snapshot.sequence;
+
+					const auto & best_ask = snapshot.asks[0];
+					const auto & best_bid = snapshot.bids[0];
+
+					if (best_ask.volume == 0 || best_bid.volume == 0)
+					{
+						return features;
+					}
+
+					features.spread = best_ask.price - best_bid.price;
+
+					features.mid = 0.5 * static_cast < double > (best_ask.price + best_bid.price);
+
+					features.microprice =
+						(static_cast < double > (best_bid.price) * best_ask.volume +
+						 static_cast < double > (best_ask.price) * best_bid.volume) / (best_ask.volume + best_bid.volume);
+
+					volume_t ask_volume = 0;
+					volume_t bid_volume = 0;
+
+					double ask_value = 0.0;
+					double bid_value = 0.0;
+
+					for (std::size_t level = 0, band = 0; level < depth; ++level)
+					{
+						const auto & ask = snapshot.asks[level];
+						const auto & bid = snapshot.bids[level];
+
+						ask_volume += ask.volume;
+						bid_volume += bid.volume;
+
+						ask_value += static_cast < double > (ask.price) * ask.volume;
+						bid_value += static_cast < double > (bid.price) * bid.volume;
+
+						for (; band < bands && band_levels[band] == level + 1U; ++band)
+						{
+							features.imbalance[band] = (static_cast < double > (bid_volume) - static_cast < double > (ask_volume)) /
+								static_cast < double > (std::max(ask_volume + bid_volume, volume_t(1)));
+						}
+
+						for (std::size_t i = 0; i < bands; ++i)
+						{
+							if (ask.volume > 0 && ask.price - best_ask.price <= band_steps[i] * step)
+							{
+								features.ask_depth[i] += ask.volume;
+							}
+
+							if (bid.volume > 0 && best_bid.price - bid.price <= band_steps[i] * step)
+							{
+								features.bid_depth[i] += bid.volume;
+							}
+						}
+					}
+
+					features.weighted_mid = 0.5 * (ask_value / ask_volume + bid_value / bid_volume);
+
+					return features;
+				}
+
+			private:
+
+				void push(const Diff & diff) noexcept
+				{
+					auto & ring = m_header->ring;
+
+					auto & slot = m_diffs[ring.size % m_capacity];
+
+					if (ring.size >= m_capacity)
+					{
+						ring.first_sequence = std::max(ring.first_sequence, slot.sequence + 1U);
+					}
+
+					slot = diff;
+
+					++ring.size;
+				}
+
+			private:
+
+				Header * m_header;
+
+				Diff * m_diffs;
+
+				const std::size_t m_capacity;
+			};
+
+		} // namespace market
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MARKET_BOOK_HPP
@@ -0,0 +1,320 @@
+#ifndef SOLUTION_SHARED_MARKET_CANDLES_HPP
+#define SOLUTION_SHARED_MARKET_CANDLES_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../../logger/logger.hpp"
+
+#include "../event/event.hpp"
+#include "../price/price.hpp"
+#include "../seqlock/seqlock.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace market
+		{
+			class candles_exception : public std::exception
+			{
+			public:
+
+				explicit candles_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit candles_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~candles_exception() noexcept = default;
+			};
+
+			struct Candle
+			{
+				using index_t = std::uint64_t;
+
+				using sequence_t = std::uint64_t;
+
+				using date_t = std::uint32_t; // YYYYMMDD
+				using time_t = std::uint32_t; // hhmmss
+
+				using price_t = Price::ticks_t;
+
+				using volume_t = std::uint64_t;
+
+				index_t index = 0;
+
+				sequence_t sequence = 0;
+
+				date_t date = 0;
+				time_t time = 0;
+
+				price_t price_open  = 0;
+				price_t price_high  = 0;
+				price_t price_low   = 0;
+				price_t price_close = 0;
+
+				volume_t volume = 0;
+			};
+
+			static_assert(std::is_trivially_copyable_v < Candle > , "Candle is not trivially copyable");
+
+			// fixed-capacity ring of candles placed in shared memory, candle with
+			// index i is stored in slot (i % capacity), readers and writer share
+			// the same layout and must agree on the capacity of the segment
+
+			class Candles
+			{
+			public:
+
+				using Candle = market::Candle;
+
+				using index_t = Candle::index_t;
+
+				using sequence_t = Candle::sequence_t;
+
+				using price_t = Candle::price_t;
+
+				using scale_t = Price::scale_t;
+
+				using candles_container_t = std::vector < Candle > ;
+
+			public:
+
+				struct Header
+				{
+					Seqlock seqlock;
+
+					Event event;
+
+					index_t first_index = 0;
+					index_t last_index  = 0;
+
+					sequence_t sequence = 0;
+
+					price_t price = 0;
+
+					scale_t scale = 0; // of prices, set once by the writer
+				};
+
+			public:
+
+				struct Cursor
+				{
+					std::atomic < sequence_t > sequence { 0 };
+				};
+
+			public:
+
+				struct Name
+				{
+					static inline const std::string cursor = "cursor_";
+				};
+
+			public:
+
+				explicit Candles(Header * header, Candle * candles, std::size_t capacity) noexcept :
+					m_header(header), m_candles(candles), m_capacity(capacity)
+				{}
+
+				~Candles() noexcept = default;
+
+			public:
+
+				auto capacity() const noexcept
+				{
+					return m_capacity;
+				}
+
+				auto & event() const noexcept
+				{
+					return m_header->event;
+				}
+
+				auto scale() const noexcept
+				{
+					return m_header->scale;
+				}
+
+			public:
+
+				template < typename Iterator >
+				void publish(Iterator first, Iterator last, price_t price) noexcept
+				{
+					std::scoped_lock < Seqlock > lock(m_header->seqlock);
+
+					for (; first != last; ++first)
+					{
+						push(*first);
+					}
+
+					m_header->price = price;
+				}
+
+				price_t price() const noexcept
+				{
+					return m_header->seqlock.read([this]() noexcept
+					{
+						return m_header->price;
+					});
+				}
+
+				bool has_updates(const Cursor & cursor) const noexcept
+				{
+					const auto sequence = m_header->seqlock.read([this]() noexcept
+					{
+						return m_header->sequence;
+					});
+
+					return (cursor.sequence.load(std::memory_order_acquire) != sequence);
+				}
+
+				candles_container_t get(Cursor & cursor, std::size_t quantity) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						const auto last_sequence = cursor.sequence.load(std::memory_order_acquire);
+
+						candles_container_t candles;
+
+						sequence_t sequence = 0;
+
+						m_header->seqlock.read([this, quantity, last_sequence, &candles, &sequence]()
+						{
+							candles.clear();
+
+							sequence = m_header->sequence;
+
+							const auto first_index = m_header->first_index;
+							const auto last_index  = m_header->last_index;
+
+							const auto size = std::min({ quantity, m_capacity, static_cast < std::size_t > (
+								(last_index == 0 || last_index < first_index) ? 0 : last_index - first_index + 1) });
+
+							// candles are published in index order, so sequence numbers grow
+							// with index and the walk stops at the first candle already seen
+
+							for (std::size_t i = 0; i < size; ++i)
+							{
+								const auto & candle = m_candles[(last_index - i) % m_capacity];
+
+								if (candle.sequence <= last_sequence && sequence >= last_sequence)
+								{
+									break;
+								}
+
+								candles.push_back(candle);
+							}
+
+							return candles.size();
+						});
+
+						std::reverse(std::begin(candles), std::end(candles));
+
+						cursor.sequence.store(sequence, std::memory_order_release);
+
+						return candles;
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < candles_exception > (logger, exception);
+					}
+				}
+
+				candles_container_t get(std::size_t quantity) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						candles_container_t candles;
+
+						candles.reserve(std::min(quantity, m_capacity));
+
+						m_header->seqlock.read([this, quantity, &candles]()
+						{
+							candles.clear();
+
+							const auto first_index = m_header->first_index;
+							const auto last_index  = m_header->last_index;
+
+							const auto size = std::min({ quantity, m_capacity, static_cast < std::size_t > (
+								(last_index == 0 || last_index < first_index) ? 0 : last_index - first_index + 1) });
+
+							for (auto index = last_index + 1 - size; index <= last_index; ++index)
+							{
+								candles.push_back(m_candles[index % m_capacity]);
+							}
+
+							return candles.size();
+						});
+
+						return candles;
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < candles_exception > (logger, exception);
+					}
+				}
+
+			private:
+
+				void push(const Candle & candle) noexcept
+				{
+					auto & slot = m_candles[candle.index % m_capacity];
+
+					slot = candle;
+
+					slot.sequence = ++m_header->sequence;
+
+					if (m_header->last_index == 0 || candle.index > m_header->last_index)
+					{
+						m_header->last_index = candle.index;
+					}
+
+					if (m_header->first_index == 0 || candle.index < m_header->first_index)
+					{
+						m_header->first_index = candle.index;
+					}
+
+					if (m_header->last_index - m_header->first_index + 1 > m_capacity)
+					{
+						m_header->first_index = m_header->last_index - m_capacity + 1;
+					}
+				}
+
+			private:
+
+				Header * m_header;
+
+				Candle * m_candles;
+
+				const std::size_t m_capacity;
+			};
+
+		} // namespace market
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MARKET_CANDLES_HPP
@@ -0,0 +1,228 @@
+#ifndef SOLUTION_SHARED_MARKET_DIRECTORY_HPP
+#define SOLUTION_SHARED_MARKET_DIRECTORY_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <boost/interprocess/managed_shared_memory.hpp>
+
+#include "../event/event.hpp"
+
+#include "../../logger/logger.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace market
+		{
+			class directory_exception : public std::exception
+			{
+			public:
+
+				explicit directory_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit directory_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~directory_exception() noexcept = default;
+			};
+
+			// header of the single market data segment, maps (asset, scale) pairs to
+			// fixed slots, quotes of an asset are registered with Name::quotes scale,
+			// generation tells readers a segment of a restarted producer from the one
+			// they have mapped, since a crashed producer never closes its directory,
+			// its event is notified on any update of any slot, for consumers that
+			// wait on many slots at once
+
+			class Directory
+			{
+			public:
+
+				using handle_t = boost::interprocess::managed_shared_memory::handle_t;
+
+				using generation_t = std::uint64_t;
+
+			public:
+
+				static constexpr std::size_t capacity  = 512U;
+				static constexpr std::size_t code_size = 16U;
+
+			public:
+
+				struct Name
+				{
+					static inline const std::string segment = "QUIK_market";
+
+					static inline const std::string quotes = "quotes";
+				};
+
+			public:
+
+				struct Entry
+				{
+					char asset_code[code_size] = {};
+					char scale_code[code_size] = {};
+
+					handle_t header = 0;
+					handle_t data   = 0;
+
+					std::uint64_t capacity = 0;
+				};
+
+			public:
+
+				Directory() noexcept : m_generation(make_generation())
+				{}
+
+				~Directory() noexcept = default;
+
+			private:
+
+				Directory			(const Directory &) = delete;
+				Directory & operator=(const Directory &) = delete;
+
+			public:
+
+				const auto & generation() const noexcept
+				{
+					return m_generation;
+				}
+
+				Event & event() noexcept
+				{
+					return m_event;
+				}
+
+				const Event & event() const noexcept
+				{
+					return m_event;
+				}
+
+				auto size() const noexcept
+				{
+					return static_cast < std::size_t > (m_size.load(std::memory_order_acquire));
+				}
+
+				bool is_closed() const noexcept
+				{
+					return m_is_closed.load(std::memory_order_acquire);
+				}
+
+				void close() noexcept
+				{
+					m_is_closed.store(true, std::memory_order_release);
+				}
+
+			public:
+
+				std::size_t append(const std::string & asset_code, const std::string & scale_code,
+					handle_t header, handle_t data, std::size_t capacity)
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						const auto index = size();
+
+						if (index >= Directory::capacity)
+						{
+							throw directory_exception("directory is full");
+						}
+
+						if (asset_code.size() >= code_size || scale_code.size() >= code_size)
+						{
+							throw directory_exception("code is too long " + asset_code + " : " + scale_code);
+						}
+
+						auto & entry = m_entries[index];
+
+						std::copy(std::begin(asset_code), std::end(asset_code), entry.asset_code);
+						std::copy(std::begin(scale_code), std::end(scale_code), entry.scale_code);
+
+						entry.header   = header;
+						entry.data     = data;
+						entry.capacity = capacity;
+
+						m_size.store(index + 1, std::memory_order_release);
+
+						return index;
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < directory_exception > (logger, exception);
+					}
+				}
+
+				const Entry & at(std::size_t index) const
+				{
+					if (index >= size())
+					{
+						throw directory_exception("invalid directory index");
+					}
+
+					return m_entries[index];
+				}
+
+				std::size_t find(const std::string & asset_code, const std::string & scale_code) const
+				{
+					for (std::size_t index = 0; index < size(); ++index)
+					{
+						const auto & entry = m_entries[index];
+
+						if (asset_code == entry.asset_code && scale_code == entry.scale_code)
+						{
+							return index;
+						}
+					}
+
+					throw directory_exception("entry not found " + asset_code + " : " + scale_code);
+				}
+
+			private:
+
+				static generation_t make_generation() noexcept // unique for each start of the producer
+				{
+					return static_cast < generation_t > (std::chrono::duration_cast < std::chrono::nanoseconds > (
+						std::chrono::system_clock::now().time_since_epoch()).count());
+				}
+
+			private:
+
+				const generation_t m_generation;
+
+				std::atomic < std::uint64_t > m_size { 0 };
+
+				std::atomic < bool > m_is_closed { false };
+
+				Event m_event;
+
+			private:
+
+				Entry m_entries[capacity];
+			};
+
+		} // namespace market
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MARKET_DIRECTORY_HPP
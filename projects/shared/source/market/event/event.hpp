@@ -0,0 +1,135 @@
+#ifndef SOLUTION_SHARED_MARKET_EVENT_HPP
+#define SOLUTION_SHARED_MARKET_EVENT_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/interprocess/sync/interprocess_condition.hpp>
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace market
+		{
+			// update notification placed in shared memory next to the published data,
+			// producer only tries the mutex, so it never waits for consumers, then a
+			// notification sent between the check of the version by a consumer and
+			// its wait is lost, so consumers wait in slices and check it again,
+			// render loops of the trader and of charts read once per frame instead
+
+			class Event
+			{
+			public:
+
+				using version_t = std::uint64_t;
+
+			private:
+
+				using atomic_version_t = std::atomic < version_t > ;
+
+				static_assert(atomic_version_t::is_always_lock_free, "version is not lock free");
+
+				using mutex_t = boost::interprocess::interprocess_mutex;
+
+				using condition_t = boost::interprocess::interprocess_condition;
+
+			public:
+
+				Event() noexcept = default;
+
+				~Event() noexcept = default;
+
+			private:
+
+				Event			(const Event &) = delete;
+				Event & operator=(const Event &) = delete;
+
+			public:
+
+				auto version() const noexcept
+				{
+					return m_version.load(std::memory_order_acquire);
+				}
+
+			public:
+
+				void notify() noexcept
+				{
+					m_version.fetch_add(1, std::memory_order_release);
+
+					if (m_mutex.try_lock())
+					{
+						m_condition.notify_all();
+
+						m_mutex.unlock();
+					}
+					else
+					{
+						m_condition.notify_all();
+					}
+				}
+
+				template < typename Rep, typename Period >
+				bool wait(version_t version, std::chrono::duration < Rep, Period > timeout) const
+				{
+					const auto deadline = boost::posix_time::microsec_clock::universal_time() +
+						boost::posix_time::milliseconds(
+							std::chrono::duration_cast < std::chrono::milliseconds > (timeout).count());
+
+					if (m_version.load(std::memory_order_acquire) != version)
+					{
+						return true;
+					}
+
+					boost::interprocess::scoped_lock < mutex_t > lock(m_mutex);
+
+					while (m_version.load(std::memory_order_acquire) == version)
+					{
+						const auto now = boost::posix_time::microsec_clock::universal_time();
+
+						if (now >= deadline)
+						{
+							return false;
+						}
+
+						m_condition.timed_wait(lock, std::min(deadline, now + slice));
+					}
+
+					return true;
+				}
+
+			private:
+
+				static inline const boost::posix_time::milliseconds slice = boost::posix_time::milliseconds(10); // bounds a lost notification
+
+			private:
+
+				atomic_version_t m_version { 0 };
+
+			private:
+
+				mutable mutex_t m_mutex;
+
+				mutable condition_t m_condition;
+			};
+
+		} // namespace market
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MARKET_EVENT_HPP
@@ -0,0 +1,232 @@
+#ifndef SOLUTION_SHARED_MARKET_PRICE_HPP
+#define SOLUTION_SHARED_MARKET_PRICE_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace market
+		{
+			class price_exception : public std::exception
+			{
+			public:
+
+				explicit price_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit price_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~price_exception() noexcept = default;
+			};
+
+			// fixed-point price: an integer number of ticks of 10^-scale, where the
+			// scale is the number of decimal digits of the instrument, prices of
+			// one instrument are compared and subtracted exactly, conversion to
+			// double is left to presentation and relative measures
+
+			class Price
+			{
+			public:
+
+				using ticks_t = std::int64_t;
+
+				using scale_t = std::uint32_t;
+
+			public:
+
+				static constexpr scale_t max_scale = 12U;
+
+			public:
+
+				static ticks_t power(scale_t scale)
+				{
+					if (scale > max_scale)
+					{
+						throw price_exception("invalid price scale " + std::to_string(scale));
+					}
+
+					ticks_t result = 1;
+
+					for (scale_t i = 0; i < scale; ++i)
+					{
+						result *= 10;
+					}
+
+					return result;
+				}
+
+				// parses [-]digits[.digits], the fraction may be shorter than the
+				// scale, digits beyond the scale are rounded half away from zero
+
+				static ticks_t parse(std::string_view text, scale_t scale)
+				{
+					while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+					{
+						text.remove_prefix(1);
+					}
+
+					while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r'))
+					{
+						text.remove_suffix(1);
+					}
+
+					const auto is_negative = (!text.empty() && text.front() == '-');
+
+					if (is_negative)
+					{
+						text.remove_prefix(1);
+					}
+
+					const auto point = text.find('.');
+
+					auto integral = text.substr(0, point);
+					auto fraction = (point == std::string_view::npos ? std::string_view() : text.substr(point + 1));
+
+					if (integral.empty() && fraction.empty())
+					{
+						throw price_exception("cannot parse price " + std::string(text) + " with scale " + std::to_string(scale));
+					}
+
+					auto is_rounded_up = false;
+
+					if (fraction.size() > scale)
+					{
+						const auto rest = fraction.substr(scale);
+
+						if (std::any_of(std::begin(rest), std::end(rest), [](auto c) { return (c < '0' || c > '9'); }))
+						{
+							throw price_exception("cannot parse price digits " + std::string(rest));
+						}
+
+						is_rounded_up = (rest.front() >= '5');
+
+						fraction = fraction.substr(0, scale);
+					}
+
+					ticks_t integral_ticks = 0;
+					ticks_t fraction_ticks = 0;
+
+					if (!integral.empty())
+					{
+						parse(integral, integral_ticks);
+					}
+
+					if (!fraction.empty())
+					{
+						parse(fraction, fraction_ticks);
+					}
+
+					const auto ticks = integral_ticks * power(scale) +
+						fraction_ticks * power(scale - static_cast < scale_t > (fraction.size())) + (is_rounded_up ? 1 : 0);
+
+					return (is_negative ? -ticks : ticks);
+				}
+
+				static scale_t decimals(std::string_view text) noexcept
+				{
+					const auto point = text.find('.');
+
+					if (point == std::string_view::npos)
+					{
+						return 0U;
+					}
+
+					scale_t result = 0U;
+
+					for (auto i = point + 1; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i)
+					{
+						++result;
+					}
+
+					return result;
+				}
+
+			public:
+
+				static ticks_t from_double(double value, scale_t scale)
+				{
+					return static_cast < ticks_t > (std::llround(value * static_cast < double > (power(scale))));
+				}
+
+				// converts ticks between scales of one instrument, digits dropped
+				// by a smaller scale are rounded half away from zero
+
+				static ticks_t rescale(ticks_t ticks, scale_t scale, scale_t new_scale)
+				{
+					if (new_scale >= scale)
+					{
+						return ticks * power(new_scale - scale);
+					}
+
+					const auto divisor = power(scale - new_scale);
+
+					const auto magnitude = ((ticks < 0 ? -ticks : ticks) + divisor / 2) / divisor;
+
+					return (ticks < 0 ? -magnitude : magnitude);
+				}
+
+				static double to_double(ticks_t ticks, scale_t scale)
+				{
+					return static_cast < double > (ticks) / static_cast < double > (power(scale));
+				}
+
+				static std::string to_string(ticks_t ticks, scale_t scale)
+				{
+					const auto divisor = power(scale);
+
+					const auto magnitude = (ticks < 0 ? -ticks : ticks);
+
+					auto result = (ticks < 0 ? std::string("-") : std::string()) + std::to_string(magnitude / divisor);
+
+					if (scale > 0)
+					{
+						auto fraction = std::to_string(magnitude % divisor);
+
+						result += '.' + std::string(scale - fraction.size(), '0') + fraction;
+					}
+
+					return result;
+				}
+
+			private:
+
+				static void parse(std::string_view digits, ticks_t & value)
+				{
+					const auto last = digits.data() + digits.size();
+
+					const auto [end, error] = std::from_chars(digits.data(), last, value);
+
+					if (digits.front() < '0' || digits.front() > '9' || error != std::errc() || end != last)
+					{
+						throw price_exception("cannot parse price digits " + std::string(digits));
+					}
+				}
+			};
+
+		} // namespace market
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MARKET_PRICE_HPP
\ No newline at end of file
@@ -0,0 +1,274 @@
+#ifndef SOLUTION_SHARED_MARKET_RECORD_HPP
+#define SOLUTION_SHARED_MARKET_RECORD_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <boost/filesystem.hpp>
+
+#include "../../logger/logger.hpp"
+
+#include "../book/book.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace market
+		{
+			class record_exception : public std::exception
+			{
+			public:
+
+				explicit record_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit record_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~record_exception() noexcept = default;
+			};
+
+			// layout of order book recordings: one file per asset and UTC day named
+			// <asset>_<YYYYMMDD>.book, a header followed by fixed-size snapshots in
+			// the order they were taken, files are written and read in native byte
+			// order by the same platform, snapshot wall time is derived from its
+			// monotonic time and the anchor of the session, so it never jumps back
+
+			class Record
+			{
+			public:
+
+				using Snapshot = Book::Snapshot;
+
+				using timestamp_t = Book::timestamp_t;
+
+				using day_t = std::int64_t; // days since epoch
+
+				using path_t = boost::filesystem::path;
+
+			public:
+
+				struct Header
+				{
+					char magic[4] = { 'B', 'O', 'O', 'K' };
+
+					std::uint32_t version = 3U;
+
+					std::uint32_t depth = static_cast < std::uint32_t > (Book::depth);
+
+					std::uint32_t size = static_cast < std::uint32_t > (sizeof(Snapshot));
+
+					Book::scale_t scale = 0; // of prices in the file
+
+					std::uint32_t reserved = 0;
+				};
+
+				static_assert(std::is_trivially_copyable_v < Header > , "Header is not trivially copyable");
+
+			public:
+
+				struct Anchor // wall and monotonic time of the same moment
+				{
+					timestamp_t wall = 0;
+					timestamp_t monotonic = 0;
+				};
+
+			public:
+
+				struct Extension
+				{
+					using extension_t = std::string;
+
+					static inline const extension_t book = ".book";
+					static inline const extension_t csv  = ".csv";
+				};
+
+			public:
+
+				static bool is_valid(const Header & header) noexcept
+				{
+					const Header expected;
+
+					return (std::equal(std::begin(header.magic), std::end(header.magic), std::begin(expected.magic)) &&
+						header.version == expected.version && header.depth == expected.depth && header.size == expected.size);
+				}
+
+				static Anchor make_anchor() noexcept
+				{
+					using namespace std::chrono;
+
+					return Anchor {
+						duration_cast < nanoseconds > (system_clock::now().time_since_epoch()).count(),
+						duration_cast < nanoseconds > (steady_clock::now().time_since_epoch()).count() };
+				}
+
+				static timestamp_t make_wall(const Anchor & anchor, timestamp_t monotonic) noexcept
+				{
+					return anchor.wall + (monotonic - anchor.monotonic);
+				}
+
+				static day_t day(timestamp_t timestamp) noexcept
+				{
+					return static_cast < day_t > ((timestamp >= 0 ? timestamp : timestamp - nanoseconds_per_day + 1) / nanoseconds_per_day);
+				}
+
+				static std::string date(day_t day)
+				{
+					// civil date from days since epoch, see H. Hinnant "chrono-compatible
+					// low-level date algorithms", avoids non thread-safe std::gmtime
+
+					const auto z = day + 719468;
+					const auto era = (z >= 0 ? z : z - 146096) / 146097;
+					const auto doe = z - era * 146097;
+					const auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+					const auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+					const auto mp = (5 * doy + 2) / 153;
+					const auto d = doy - (153 * mp + 2) / 5 + 1;
+					const auto m = mp + (mp < 10 ? 3 : -9);
+					const auto y = yoe + era * 400 + (m <= 2 ? 1 : 0);
+
+					char buffer[16];
+
+					std::snprintf(buffer, sizeof(buffer), "%04d%02d%02d",
+						static_cast < int > (y), static_cast < int > (m), static_cast < int > (d));
+
+					return buffer;
+				}
+
+				static day_t make_day(std::uint32_t date) noexcept // from YYYYMMDD, inverse of date
+				{
+					const auto m = static_cast < day_t > (date / 100 % 100);
+					const auto d = static_cast < day_t > (date % 100);
+					const auto y = static_cast < day_t > (date / 10000) - (m <= 2 ? 1 : 0);
+					const auto era = (y >= 0 ? y : y - 399) / 400;
+					const auto yoe = y - era * 400;
+					const auto doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+					const auto doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+					return era * 146097 + doe - 719468;
+				}
+
+				static path_t make_path(const path_t & directory, const std::string & asset_code, day_t day)
+				{
+					auto path = directory; path /= asset_code + "_" + date(day) + Extension::book;
+
+					return path;
+				}
+
+			public:
+
+				static constexpr timestamp_t nanoseconds_per_day = 86400LL * 1000000000LL;
+			};
+
+			// sequential reader of one recording, validates the header on opening
+
+			class Reader
+			{
+			public:
+
+				using Snapshot = Record::Snapshot;
+
+				using path_t = Record::path_t;
+
+			public:
+
+				explicit Reader(const path_t & path) : m_path(path)
+				{
+					initialize();
+				}
+
+				~Reader() noexcept = default;
+
+			private:
+
+				void initialize()
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						m_fin.open(m_path.string(), std::ios::in | std::ios::binary);
+
+						if (!m_fin)
+						{
+							throw record_exception("cannot open file " + m_path.string());
+						}
+
+						if (!m_fin.read(reinterpret_cast < char * > (&m_header), sizeof(m_header)) || !Record::is_valid(m_header))
+						{
+							throw record_exception("invalid header in file " + m_path.string());
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < record_exception > (logger, exception);
+					}
+				}
+
+			public:
+
+				const auto & path() const noexcept
+				{
+					return m_path;
+				}
+
+				auto scale() const noexcept
+				{
+					return m_header.scale;
+				}
+
+				auto size() const noexcept
+				{
+					return m_size;
+				}
+
+			public:
+
+				bool next(Snapshot & snapshot)
+				{
+					if (!m_fin.read(reinterpret_cast < char * > (&snapshot), sizeof(snapshot)))
+					{
+						return false; // a truncated last snapshot is ignored
+					}
+
+					++m_size;
+
+					return true;
+				}
+
+			private:
+
+				const path_t m_path;
+
+				std::ifstream m_fin;
+
+				Record::Header m_header;
+
+				std::size_t m_size = 0;
+			};
+
+		} // namespace market
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MARKET_RECORD_HPP
\ No newline at end of file
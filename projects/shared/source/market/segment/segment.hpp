@@ -0,0 +1,314 @@
+#ifndef SOLUTION_SHARED_MARKET_SEGMENT_HPP
+#define SOLUTION_SHARED_MARKET_SEGMENT_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include <boost/interprocess/managed_shared_memory.hpp>
+
+#include "../../logger/logger.hpp"
+
+#include "../book/book.hpp"
+#include "../candles/candles.hpp"
+#include "../directory/directory.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace market
+		{
+			class segment_exception : public std::exception
+			{
+			public:
+
+				explicit segment_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit segment_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~segment_exception() noexcept = default;
+			};
+
+			// reader side of the market data segment: maps it once and resolves slots
+			// through the directory once, update() maps it again after the producer
+			// has closed the directory or, checked once per check period, after a
+			// producer of another generation has replaced the segment, references
+			// returned before become invalid
+
+			class Segment
+			{
+			private:
+
+				using shared_memory_t = boost::interprocess::managed_shared_memory;
+
+				using candles_container_t = std::unordered_map < std::string, Candles > ;
+
+				using books_container_t = std::unordered_map < std::string, Book > ;
+
+				using cursors_container_t = std::unordered_map < std::string, Candles::Cursor * > ;
+
+			public:
+
+				Segment() = default;
+
+				~Segment() noexcept = default;
+
+			private:
+
+				Segment			  (const Segment &) = delete;
+				Segment & operator=(const Segment &) = delete;
+
+			public:
+
+				Candles & candles(const std::string & asset, const std::string & scale)
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						open();
+
+						const auto key = asset + "_" + scale;
+
+						if (auto iterator = m_candles.find(key); iterator != std::end(m_candles))
+						{
+							return iterator->second;
+						}
+
+						const auto & entry = m_directory->at(m_directory->find(asset, scale));
+
+						return m_candles.emplace(key, Candles(
+							static_cast < Candles::Header * > (m_shared_memory->get_address_from_handle(entry.header)),
+							static_cast < Candle * > (m_shared_memory->get_address_from_handle(entry.data)),
+							static_cast < std::size_t > (entry.capacity))).first->second;
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < segment_exception > (logger, exception);
+					}
+				}
+
+				Book & book(const std::string & asset)
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						open();
+
+						if (auto iterator = m_books.find(asset); iterator != std::end(m_books))
+						{
+							return iterator->second;
+						}
+
+						const auto & entry = m_directory->at(m_directory->find(asset, Directory::Name::quotes));
+
+						return m_books.emplace(asset, Book(
+							static_cast < Book::Header * > (m_shared_memory->get_address_from_handle(entry.header)),
+							static_cast < Book::Diff * > (m_shared_memory->get_address_from_handle(entry.data)),
+							static_cast < std::size_t > (entry.capacity))).first->second;
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < segment_exception > (logger, exception);
+					}
+				}
+
+				Candles::Cursor & cursor(const std::string & consumer, const std::string & asset, const std::string & scale)
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						open();
+
+						const auto key = consumer + "_" + asset + "_" + scale;
+
+						if (auto iterator = m_cursors.find(key); iterator != std::end(m_cursors))
+						{
+							return *(iterator->second);
+						}
+
+						auto cursor = m_shared_memory->find_or_construct < Candles::Cursor > (
+							(Candles::Name::cursor + key).c_str())();
+
+						return *(m_cursors.emplace(key, cursor).first->second);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < segment_exception > (logger, exception);
+					}
+				}
+
+				const Event & event() // of any update in the segment
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						open();
+
+						return m_directory->event();
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < segment_exception > (logger, exception);
+					}
+				}
+
+				Directory::generation_t generation() // of the mapped producer, changes on remap
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						open();
+
+						return m_directory->generation();
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < segment_exception > (logger, exception);
+					}
+				}
+
+			public:
+
+				void update()
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						if (m_shared_memory && (m_directory->is_closed() || is_replaced()))
+						{
+							close();
+						}
+
+						open();
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < segment_exception > (logger, exception);
+					}
+				}
+
+			private:
+
+				void open()
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						if (m_shared_memory)
+						{
+							return;
+						}
+
+						m_shared_memory = std::make_unique < shared_memory_t > (
+							boost::interprocess::open_only, Directory::Name::segment.c_str());
+
+						m_directory = m_shared_memory->find < Directory > (boost::interprocess::unique_instance).first;
+
+						if (!m_directory)
+						{
+							m_shared_memory.reset();
+
+							throw segment_exception("directory not found");
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < segment_exception > (logger, exception);
+					}
+				}
+
+				bool is_replaced()
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						const auto now = std::chrono::steady_clock::now();
+
+						if (now - m_last_check < check_period)
+						{
+							return false;
+						}
+
+						m_last_check = now;
+
+						try
+						{
+							shared_memory_t shared_memory(boost::interprocess::open_only, Directory::Name::segment.c_str());
+
+							const auto directory = shared_memory.find < Directory > (boost::interprocess::unique_instance).first;
+
+							return (directory && directory->generation() != m_directory->generation());
+						}
+						catch (const boost::interprocess::interprocess_exception &)
+						{
+							return false; // removed and not created again yet, the mapped one is kept
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < segment_exception > (logger, exception);
+					}
+				}
+
+				void close() noexcept
+				{
+					m_candles.clear();
+					m_books.clear();
+					m_cursors.clear();
+
+					m_directory = nullptr;
+
+					m_shared_memory.reset();
+				}
+
+			private:
+
+				static inline const std::chrono::seconds check_period = std::chrono::seconds(1);
+
+			private:
+
+				std::unique_ptr < shared_memory_t > m_shared_memory;
+
+				Directory * m_directory = nullptr;
+
+				std::chrono::steady_clock::time_point m_last_check;
+
+			private:
+
+				candles_container_t m_candles;
+
+				books_container_t m_books;
+
+				cursors_container_t m_cursors;
+			};
+
+		} // namespace market
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MARKET_SEGMENT_HPP
@@ -0,0 +1,108 @@
+#ifndef SOLUTION_SHARED_MARKET_SEQLOCK_HPP
+#define SOLUTION_SHARED_MARKET_SEQLOCK_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace market
+		{
+			// single writer / multiple readers publication protocol for data placed
+			// in shared memory: writer never waits, reader repeats its copy until
+			// the version is even and unchanged around it
+
+			class Seqlock
+			{
+			public:
+
+				using version_t = std::uint64_t;
+
+			private:
+
+				using atomic_version_t = std::atomic < version_t > ;
+
+				static_assert(atomic_version_t::is_always_lock_free, "version is not lock free");
+
+			public:
+
+				Seqlock() noexcept = default;
+
+				~Seqlock() noexcept = default;
+
+			private:
+
+				Seqlock			  (const Seqlock &) = delete;
+				Seqlock & operator=(const Seqlock &) = delete;
+
+			public:
+
+				auto version() const noexcept
+				{
+					return m_version.load(std::memory_order_acquire);
+				}
+
+			public:
+
+				void lock() noexcept
+				{
+					m_version.store(m_version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+					std::atomic_thread_fence(std::memory_order_release);
+				}
+
+				void unlock() noexcept
+				{
+					m_version.store(m_version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+				}
+
+			public:
+
+				template < typename F >
+				auto read(F && f) const
+				{
+					while (true)
+					{
+						const auto version_before = m_version.load(std::memory_order_acquire);
+
+						if (version_before & 1U)
+						{
+							std::this_thread::yield();
+
+							continue;
+						}
+
+						auto result = f();
+
+						std::atomic_thread_fence(std::memory_order_acquire);
+
+						if (version_before == m_version.load(std::memory_order_relaxed))
+						{
+							return result;
+						}
+					}
+				}
+
+			private:
+
+				atomic_version_t m_version { 0 };
+			};
+
+		} // namespace market
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MARKET_SEQLOCK_HPP
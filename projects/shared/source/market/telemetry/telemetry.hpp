@@ -0,0 +1,203 @@
+#ifndef SOLUTION_SHARED_MARKET_TELEMETRY_HPP
+#define SOLUTION_SHARED_MARKET_TELEMETRY_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "../../logger/logger.hpp"
+
+#include "../directory/directory.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace market
+		{
+			class telemetry_exception : public std::exception
+			{
+			public:
+
+				explicit telemetry_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit telemetry_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~telemetry_exception() noexcept = default;
+			};
+
+			// health of producers placed in a segment of its own, so a monitor never
+			// maps market data, each entry belongs to one source or quotes of the
+			// plugin, each counter is written by one thread without read-modify-write,
+			// readers see every counter consistent but not all of them at once
+
+			class Telemetry
+			{
+			public:
+
+				using counter_t = std::uint64_t;
+
+				using timestamp_t = std::int64_t; // nanoseconds since epoch
+
+				using duration_t = std::chrono::nanoseconds;
+
+			public:
+
+				static constexpr std::size_t capacity  = Directory::capacity;
+				static constexpr std::size_t code_size = Directory::code_size;
+
+				static constexpr std::size_t buckets = 24U; // bucket i > 0 counts [2^(i-1), 2^i) microseconds
+
+			public:
+
+				struct Name
+				{
+					static inline const std::string segment = "QUIK_telemetry";
+				};
+
+			public:
+
+				struct Entry
+				{
+					char asset_code[code_size] = {};
+					char scale_code[code_size] = {}; // Directory::Name::quotes for quotes
+
+					std::atomic < timestamp_t > last_update { 0 }; // of the last successful update
+
+					std::atomic < counter_t > updates { 0 };
+					std::atomic < counter_t > errors  { 0 };
+					std::atomic < counter_t > calls   { 0 }; // to the provider
+
+					std::atomic < counter_t > pushed  { 0 }; // candles published or snapshots passed to recorder
+					std::atomic < counter_t > popped  { 0 }; // snapshots written by recorder
+					std::atomic < counter_t > dropped { 0 }; // snapshots recorder had no room for
+
+					std::atomic < counter_t > durations[buckets] = {}; // of successful updates
+				};
+
+			public:
+
+				Telemetry() noexcept = default;
+
+				~Telemetry() noexcept = default;
+
+			private:
+
+				Telemetry			(const Telemetry &) = delete;
+				Telemetry & operator=(const Telemetry &) = delete;
+
+			public:
+
+				auto size() const noexcept
+				{
+					return static_cast < std::size_t > (m_size.load(std::memory_order_acquire));
+				}
+
+			public:
+
+				Entry & append(const std::string & asset_code, const std::string & scale_code)
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						const auto index = size();
+
+						if (index >= Telemetry::capacity)
+						{
+							throw telemetry_exception("telemetry is full");
+						}
+
+						if (asset_code.size() >= code_size || scale_code.size() >= code_size)
+						{
+							throw telemetry_exception("code is too long " + asset_code + " : " + scale_code);
+						}
+
+						auto & entry = m_entries[index];
+
+						std::copy(std::begin(asset_code), std::end(asset_code), entry.asset_code);
+						std::copy(std::begin(scale_code), std::end(scale_code), entry.scale_code);
+
+						m_size.store(index + 1, std::memory_order_release);
+
+						return entry;
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < telemetry_exception > (logger, exception);
+					}
+				}
+
+				const Entry & at(std::size_t index) const
+				{
+					if (index >= size())
+					{
+						throw telemetry_exception("invalid telemetry index");
+					}
+
+					return m_entries[index];
+				}
+
+			public:
+
+				static void add(std::atomic < counter_t > & counter, counter_t value = 1U) noexcept
+				{
+					counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+				}
+
+				static void complete(Entry & entry, duration_t duration) noexcept // of a successful update
+				{
+					add(entry.updates);
+
+					add(entry.durations[bucket(duration)]);
+
+					entry.last_update.store(std::chrono::duration_cast < duration_t > (
+						std::chrono::system_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+				}
+
+				static std::size_t bucket(duration_t duration) noexcept
+				{
+					auto microseconds = std::chrono::duration_cast < std::chrono::microseconds > (duration).count();
+
+					std::size_t bucket = 0;
+
+					for (; microseconds > 0 && bucket + 1U < buckets; microseconds >>= 1)
+					{
+						++bucket;
+					}
+
+					return bucket;
+				}
+
+			private:
+
+				std::atomic < std::uint64_t > m_size { 0 };
+
+			private:
+
+				Entry m_entries[capacity];
+			};
+
+		} // namespace market
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MARKET_TELEMETRY_HPP
\ No newline at end of file
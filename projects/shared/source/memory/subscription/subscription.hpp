@@ -0,0 +1,188 @@
+#ifndef SOLUTION_SHARED_MEMORY_SUBSCRIPTION_HPP
+#define SOLUTION_SHARED_MEMORY_SUBSCRIPTION_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../config/config.hpp"
+#include "../../logger/logger.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace memory
+		{
+			class subscription_exception : public std::exception
+			{
+			public:
+
+				explicit subscription_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit subscription_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~subscription_exception() noexcept = default;
+			};
+
+			// waitable queue of keys written since the last take, a write matches
+			// when the words of its key include all words of the subscription,
+			// a key written many times before the reader takes it is kept once,
+			// so the reader follows the rate of updates rather than of polls
+
+			class Subscription
+			{
+			public:
+
+				using ids_container_t = Config::ids_container_t;
+
+				using ids_union_t = ids_container_t; // sorted without duplicates
+
+				using keys_container_t = std::vector < ids_union_t > ; // sorted
+
+				using duration_t = std::chrono::milliseconds;
+
+			private:
+
+				using pending_keys_container_t = std::set < ids_union_t > ;
+
+				using mutex_t = std::mutex;
+
+				using condition_t = std::condition_variable;
+
+			public:
+
+				explicit Subscription(ids_union_t ids) : m_ids(std::move(ids))
+				{}
+
+				~Subscription() noexcept = default;
+
+			private:
+
+				Subscription			(const Subscription &) = delete;
+				Subscription & operator=(const Subscription &) = delete;
+
+			public:
+
+				const auto & ids() const noexcept
+				{
+					return m_ids;
+				}
+
+				bool matches(const ids_union_t & key) const
+				{
+					return std::includes(std::begin(key), std::end(key), std::begin(m_ids), std::end(m_ids));
+				}
+
+			public:
+
+				void notify(const ids_union_t & key)
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						{
+							std::scoped_lock < mutex_t > lock(m_mutex);
+
+							m_pending_keys.insert(key);
+						}
+
+						m_condition.notify_one();
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < subscription_exception > (logger, exception);
+					}
+				}
+
+				// both return false when no key was written, keys are replaced
+
+				bool poll(keys_container_t & keys)
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						std::scoped_lock < mutex_t > lock(m_mutex);
+
+						return take(keys);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < subscription_exception > (logger, exception);
+					}
+				}
+
+				bool wait(keys_container_t & keys, duration_t timeout)
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						std::unique_lock < mutex_t > lock(m_mutex);
+
+						m_condition.wait_for(lock, timeout, [this]()
+						{
+							return !m_pending_keys.empty();
+						});
+
+						return take(keys);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < subscription_exception > (logger, exception);
+					}
+				}
+
+			private:
+
+				bool take(keys_container_t & keys)
+				{
+					keys.assign(std::begin(m_pending_keys), std::end(m_pending_keys));
+
+					m_pending_keys.clear();
+
+					return !keys.empty();
+				}
+
+			private:
+
+				const ids_union_t m_ids;
+
+			private:
+
+				pending_keys_container_t m_pending_keys;
+
+			private:
+
+				mutable mutex_t m_mutex;
+
+				condition_t m_condition;
+			};
+
+		} // namespace memory
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MEMORY_SUBSCRIPTION_HPP
\ No newline at end of file
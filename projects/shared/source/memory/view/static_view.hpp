@@ -0,0 +1,1039 @@
+#ifndef SOLUTION_SHARED_MEMORY_STATIC_VIEW_HPP
+#define SOLUTION_SHARED_MEMORY_STATIC_VIEW_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "../../config/config.hpp"
+#include "../../logger/logger.hpp"
+#include "../../object/object.hpp"
+
+#include "../subscription/subscription.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		namespace memory
+		{
+			class view_base_exception : public std::exception
+			{
+			public:
+
+				explicit view_base_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit view_base_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~view_base_exception() noexcept = default;
+			};
+
+			// statically dispatched view, hooks of the derived view are called
+			// directly, so a view in the module of memory inlines down to memory
+			// calls, View_Base adapts it to virtual hooks for views passed to
+			// actions across the module boundary
+
+			template < typename Derived >
+			class Static_View
+			{
+			public:
+
+				using words_container_t = Config::words_container_t;
+
+				using id_t = Config::id_t;
+
+				using ids_container_t = Config::ids_container_t;
+
+				using ids_union_t = ids_container_t; // sorted without duplicates
+
+				using generation_t = std::uint64_t; // of memory nodes, changes when a node is removed
+
+				using Object = shared::Object;
+
+				using data_t = Object::data_t;
+
+				using timestamp_t = Object::timestamp_t;
+
+				using samples_container_t = Object::samples_container_t;
+
+				template < typename T >
+				using series_t = std::vector < std::pair < timestamp_t, T > > ; // from the oldest sample
+
+				using Subscription = memory::Subscription;
+
+			public:
+
+				enum class Mode
+				{
+					shared,
+					unique
+				};
+
+			private:
+
+				struct Status
+				{
+					using status_t = std::uint8_t;
+
+					static inline const status_t released = 0;
+
+					struct Acquired
+					{
+						static inline const status_t shared = 1;
+						static inline const status_t unique = 2;
+					};
+				};
+
+			private:
+
+				using status_t = typename Status::status_t;
+
+			private:
+
+				class Lock
+				{
+				public:
+
+					template < typename I, typename Enable = 
+						std::enable_if_t < std::is_convertible_v < I, ids_union_t > > >
+					explicit Lock(const Static_View & view, Mode mode, I && ids) :
+						m_view(view), m_mode(mode), m_ids(std::forward < I > (ids))
+					{
+						initialize();
+					}
+
+					~Lock() noexcept
+					{
+						try
+						{
+							uninitialize();
+						}
+						catch (...)
+						{
+							// std::abort
+						}
+					}
+
+				private:
+
+					void initialize()
+					{
+						RUN_LOGGER(logger);
+
+						try
+						{
+							m_view.acquire(m_mode, m_ids);
+
+							m_is_locked = true;
+						}
+						catch (const std::exception & exception)
+						{
+							catch_handler < view_base_exception > (logger, exception);
+						}
+					}
+
+					void uninitialize()
+					{
+						RUN_LOGGER(logger);
+
+						try
+						{
+							m_view.release(m_mode, m_ids);
+
+							m_is_locked = false;
+						}
+						catch (const std::exception & exception)
+						{
+							catch_handler < view_base_exception > (logger, exception);
+						}
+					}
+
+				private:
+
+					const Static_View & m_view;
+
+				private:
+
+					const Mode m_mode;
+
+					const ids_union_t m_ids;
+
+				private:
+
+					mutable bool m_is_locked = false;
+				};
+
+			public:
+
+				// key resolved once to its object, stays bound while no node is
+				// removed and is resolved again on the next use otherwise, used by
+				// one thread at a time as the view itself
+
+				class Handle
+				{
+				public:
+
+					Handle() noexcept = default;
+
+					~Handle() noexcept = default;
+
+				private:
+
+					explicit Handle(ids_union_t ids) noexcept : m_ids(std::move(ids))
+					{}
+
+				public:
+
+					const auto & ids() const noexcept
+					{
+						return m_ids;
+					}
+
+					bool is_prepared() const noexcept
+					{
+						return !m_ids.empty();
+					}
+
+				private:
+
+					friend class Static_View;
+
+				private:
+
+					ids_union_t m_ids;
+
+					mutable std::shared_ptr < Object > m_object;
+
+					mutable generation_t m_generation = 0;
+				};
+
+			public:
+
+				Static_View() noexcept = default;
+
+			protected:
+
+				~Static_View() noexcept = default;
+
+			public:
+
+				ids_container_t intern(const words_container_t & words) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						ids_container_t ids;
+
+						ids.reserve(std::size(words));
+
+						derived().intern_implementation(words, ids);
+
+						return ids;
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				Handle prepare(const words_container_t & words) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						auto ids = intern(words);
+
+						std::sort(std::begin(ids), std::end(ids));
+
+						ids.erase(std::unique(std::begin(ids), std::end(ids)), std::end(ids));
+
+						Handle handle(std::move(ids));
+
+						resolve(handle, Mode::shared);
+
+						return handle;
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				// objects need not exist yet, writes of objects created later match
+				// as well, the subscription stays active while it is referenced
+
+				std::shared_ptr < Subscription > subscribe(const words_container_t & words) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						auto ids = intern(words);
+
+						std::sort(std::begin(ids), std::end(ids));
+
+						ids.erase(std::unique(std::begin(ids), std::end(ids)), std::end(ids));
+
+						std::shared_ptr < Subscription > subscription;
+
+						derived().subscribe_implementation(ids, subscription);
+
+						return subscription;
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+			public:
+
+				template < typename ... Types >
+				void get(const std::pair < words_container_t, Types > & ... pairs) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						get(std::pair < ids_container_t, Types > (intern(pairs.first), pairs.second)...);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename ... Types >
+				void set(const std::pair < words_container_t, Types > & ... pairs) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						set(std::pair < ids_container_t, Types > (intern(pairs.first), pairs.second)...);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+			public:
+
+				// fast path for words interned once in advance
+
+				template < typename ... Types >
+				void get(const std::pair < ids_container_t, Types > & ... pairs) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						Lock lock(*this, Mode::shared, extract_ids(pairs...));
+
+						get_pairs(pairs...);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename ... Types >
+				void set(const std::pair < ids_container_t, Types > & ... pairs) const
+				{
+					RUN_LOGGER(logger);
+					
+					try
+					{
+						Lock lock(*this, Mode::unique, extract_ids(pairs...));
+						
+						set_pairs(pairs...);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+			public:
+
+				// single object lock, the object of a handle used for get is expected
+				// to exist, the one used for set is created on first use
+
+				template < typename T >
+				void get(const Handle & handle, T & result) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						load(bound_object(handle), result);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename T >
+				void set(const Handle & handle, const T & data) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						bind_or_create(handle, data);
+
+						derived().store_implementation(handle.m_ids, *handle.m_object, make_data(data));
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+			public:
+
+				// handles of a group are read or written under locks of all their
+				// nodes, as pairs of words, so a reader of the group never mixes
+				// values of two writes, handles are bound before the nodes are locked
+
+				template < typename ... Types >
+				void get(const std::pair < const Handle &, Types & > & ... pairs) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						(bind(pairs.first, Mode::shared), ...);
+
+						Lock lock(*this, Mode::shared, unite(pairs.first.m_ids...));
+
+						(load(*pairs.first.m_object, pairs.second), ...);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename ... Types >
+				void set(const std::pair < const Handle &, Types > & ... pairs) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						(bind_or_create(pairs.first, pairs.second), ...);
+
+						Lock lock(*this, Mode::unique, unite(pairs.first.m_ids...));
+
+						(derived().store_implementation(pairs.first.m_ids, *pairs.first.m_object, make_data(pairs.second)), ...);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+			public:
+
+				// history of an object, kept from the moment a capacity is set, the
+				// object of a handle is expected to exist as for get, so history is
+				// set after the first write, samples not convertible to T are errors
+
+				void set_history(const Handle & handle, std::size_t capacity) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						bind(handle, Mode::shared);
+
+						derived().history_implementation(*handle.m_object, capacity);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				void set_history(const words_container_t & words, std::size_t capacity) const
+				{
+					set_history(prepare(words), capacity);
+				}
+
+				template < typename T >
+				void get_range(const Handle & handle, timestamp_t begin, timestamp_t end, series_t < T > & series) const // [begin, end)
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						samples_container_t samples;
+
+						derived().load_range_implementation(bound_object(handle), begin, end, samples);
+
+						extract_samples(samples, series);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename T >
+				void get_range(const words_container_t & words, timestamp_t begin, timestamp_t end, series_t < T > & series) const
+				{
+					get_range(prepare(words), begin, end, series);
+				}
+
+				template < typename T >
+				void get_last_n(const Handle & handle, std::size_t size, series_t < T > & series) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						samples_container_t samples;
+
+						derived().load_last_implementation(bound_object(handle), size, samples);
+
+						extract_samples(samples, series);
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename T >
+				void get_last_n(const words_container_t & words, std::size_t size, series_t < T > & series) const
+				{
+					get_last_n(prepare(words), size, series);
+				}
+
+			private:
+				
+				template < typename ... Types >
+				ids_union_t extract_ids(const std::pair < ids_container_t, Types > & ... pairs) const
+				{
+					return unite(pairs.first...);
+				}
+
+				template < typename ... Containers >
+				ids_union_t unite(const Containers & ... containers) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						ids_union_t ids;
+
+						ids.reserve((std::size(containers) + ...));
+
+						(ids.insert(std::end(ids), std::begin(containers), std::end(containers)), ...);
+
+						std::sort(std::begin(ids), std::end(ids));
+
+						ids.erase(std::unique(std::begin(ids), std::end(ids)), std::end(ids));
+
+						return ids;
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+			private:
+
+				void acquire(Mode mode, const ids_union_t & ids) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						if (m_status == Status::Acquired::shared)
+						{
+							throw view_base_exception("already acquired shared");
+						}
+
+						if (m_status == Status::Acquired::unique)
+						{
+							throw view_base_exception("already acquired unique");
+						}
+
+						derived().acquire_implementation(mode, ids);
+
+						switch (mode)
+						{
+						case Mode::shared:
+						{
+							m_status = Status::Acquired::shared;
+
+							break;
+						}
+						case Mode::unique:
+						{
+							m_status = Status::Acquired::unique;
+
+							break;
+						}
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				void release(Mode mode, const ids_union_t & ids) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						if (mode == Mode::shared && (m_status != Status::Acquired::shared))
+						{
+							throw view_base_exception("not acquired shared");
+						}
+
+						if (mode == Mode::unique && (m_status != Status::Acquired::unique))
+						{
+							throw view_base_exception("not acquired unique");
+						}
+
+						derived().release_implementation(mode, ids);
+
+						m_status = Status::released;
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+			private:
+
+				bool is_bound(const Handle & handle) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						if (handle.m_ids.empty())
+						{
+							throw view_base_exception("handle not prepared");
+						}
+
+						return (handle.m_object && handle.m_generation == derived().generation_implementation());
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				// an object not found is created only with the value of its first
+				// write, so readers and snapshots never see a default value
+
+				void resolve(const Handle & handle, Mode mode, const data_t * data = nullptr) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						Lock lock(*this, mode, handle.m_ids);
+
+						// generation is read first, so a node removed meanwhile leaves
+						// the handle unbound rather than bound to an orphan object
+
+						handle.m_generation = derived().generation_implementation();
+
+						handle.m_object.reset();
+
+						derived().resolve_implementation(handle.m_ids, data, handle.m_object);
+
+						if (data && !handle.m_object)
+						{
+							throw view_base_exception("object not created");
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				void bind(const Handle & handle, Mode mode) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						if (!is_bound(handle))
+						{
+							resolve(handle, mode);
+
+							if (!handle.m_object)
+							{
+								throw view_base_exception("object not found");
+							}
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename T >
+				void bind_or_create(const Handle & handle, const T & data) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						if (!is_bound(handle))
+						{
+							const auto first = make_data(data);
+
+							resolve(handle, Mode::unique, &first);
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				const Object & bound_object(const Handle & handle) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						bind(handle, Mode::shared);
+
+						return *handle.m_object;
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename T >
+				void load(const Object & object, T & result) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						data_t data;
+
+						derived().load_implementation(object, data);
+
+						extract_data(data, result);
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+			private:
+
+				template < typename Type, typename ... Types >
+				void get_pairs(
+					const std::pair < ids_container_t, Type  > &     pair,
+					const std::pair < ids_container_t, Types > & ... pairs) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						get(pair.first, pair.second);
+
+						if constexpr (sizeof...(pairs) > 0)
+						{
+							get_pairs(pairs...);
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+				
+				template < typename Type, typename ... Types >
+				void set_pairs(
+					const std::pair < ids_container_t, Type  > &     pair,
+					const std::pair < ids_container_t, Types > & ... pairs) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						set(pair.first, pair.second);
+
+						if constexpr (sizeof...(pairs) > 0)
+						{
+							set_pairs(pairs...);
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						shared::catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+				
+			private:
+
+				template < typename T >
+				T get(const ids_container_t & ids) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						T result;
+
+						if (m_status == Status::Acquired::shared)
+						{
+							data_t data;
+
+							derived().get_implementation(ids, data);
+
+							extract_data(data, result);
+						}
+						else
+						{
+							throw view_base_exception("memory not acquired shared");
+						}
+
+						return result;
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename T >
+				void get(const ids_container_t & ids, T & result) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						if (m_status == Status::Acquired::shared)
+						{
+							data_t data;
+
+							derived().get_implementation(ids, data);
+
+							extract_data(data, result);
+						}
+						else
+						{
+							throw view_base_exception("memory not acquired shared");
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+				template < typename T >
+				void get(const ids_container_t & ids, const std::reference_wrapper < T > & result) const
+				{
+					get(ids, result.get());
+				}
+
+				template < typename T >
+				void set(const ids_container_t & ids, const T & data) const
+				{
+					RUN_LOGGER(logger);
+
+					try
+					{
+						if (m_status == Status::Acquired::unique)
+						{
+							derived().set_implementation(ids, make_data(data));
+						}
+						else
+						{
+							throw view_base_exception("memory not acquired unique");
+						}
+					}
+					catch (const std::exception & exception)
+					{
+						catch_handler < view_base_exception > (logger, exception);
+					}
+				}
+
+			private:
+
+				template < typename T, typename Enable = void >
+				struct is_sequence : std::false_type {};
+
+				template < typename T >
+				struct is_sequence < T, std::void_t < typename T::value_type,
+					decltype(std::begin(std::declval < const T & > ())), decltype(std::end(std::declval < const T & > ())) > > :
+					std::bool_constant < std::is_arithmetic_v < typename T::value_type > > {};
+
+			private:
+
+				// numbers keep their kind, so integer totals are not rounded through
+				// double, other types that can only be streamed are kept as text
+
+				template < typename T >
+				static data_t make_data(const T & value)
+				{
+					if constexpr (std::is_same_v < T, bool > || (std::is_integral_v < T > && std::is_unsigned_v < T >))
+					{
+						return data_t(std::in_place_type < std::uint64_t > , static_cast < std::uint64_t > (value));
+					}
+					else if constexpr (std::is_integral_v < T > )
+					{
+						return data_t(std::in_place_type < std::int64_t > , static_cast < std::int64_t > (value));
+					}
+					else if constexpr (std::is_floating_point_v < T > )
+					{
+						return data_t(std::in_place_type < double > , static_cast < double > (value));
+					}
+					else if constexpr (std::is_convertible_v < const T &, std::string > )
+					{
+						return data_t(std::in_place_type < std::string > , value);
+					}
+					else if constexpr (is_sequence < T > ::value)
+					{
+						return data_t(std::in_place_type < Object::vector_t > , std::begin(value), std::end(value));
+					}
+					else
+					{
+						std::stringstream sout;
+
+						sout << value;
+
+						return data_t(std::in_place_type < std::string > , sout.str());
+					}
+				}
+
+				template < typename T >
+				static void extract_data(const data_t & data, T & result)
+				{
+					if constexpr (std::is_arithmetic_v < T > )
+					{
+						std::visit([&result](const auto & value)
+						{
+							if constexpr (std::is_arithmetic_v < std::decay_t < decltype(value) > > )
+							{
+								result = static_cast < T > (value);
+							}
+							else
+							{
+								throw view_base_exception("object is not a number");
+							}
+						}, data);
+					}
+					else if constexpr (std::is_same_v < T, std::string > )
+					{
+						if (auto value = std::get_if < std::string > (&data); value)
+						{
+							result = *value;
+						}
+						else
+						{
+							throw view_base_exception("object is not a string");
+						}
+					}
+					else if constexpr (is_sequence < T > ::value)
+					{
+						if (auto value = std::get_if < Object::vector_t > (&data); value)
+						{
+							result = T(std::begin(*value), std::end(*value));
+						}
+						else
+						{
+							throw view_base_exception("object is not a vector");
+						}
+					}
+					else
+					{
+						if (auto value = std::get_if < std::string > (&data); value)
+						{
+							std::stringstream sin(*value);
+
+							sin >> result;
+						}
+						else
+						{
+							throw view_base_exception("object is not a text");
+						}
+					}
+				}
+
+				template < typename T >
+				static void extract_samples(const samples_container_t & samples, series_t < T > & series)
+				{
+					series.clear();
+
+					series.reserve(std::size(samples));
+
+					for (const auto & sample : samples)
+					{
+						T result;
+
+						extract_data(sample.data, result);
+
+						series.emplace_back(sample.timestamp, std::move(result));
+					}
+				}
+
+			private:
+
+				const Derived & derived() const noexcept
+				{
+					return static_cast < const Derived & > (*this);
+				}
+
+			private:
+
+				mutable status_t m_status = Status::released;
+			};
+
+		} // namespace memory
+		
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_MEMORY_STATIC_VIEW_HPP
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "epoch.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		std::atomic < Epoch::epoch_t > Epoch::global_epoch { 0 };
+
+		Epoch::Slot Epoch::slots[capacity];
+
+		std::mutex Epoch::retired_mutex;
+
+		Epoch::retired_container_t Epoch::retired_versions;
+
+		void Epoch::retire(retired_t retired)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::scoped_lock < std::mutex > lock(retired_mutex);
+
+				retired_versions.emplace_back(global_epoch.fetch_add(1U), std::move(retired));
+
+				if (std::size(retired_versions) >= threshold)
+				{
+					reclaim();
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				catch_handler < epoch_exception > (logger, exception);
+			}
+		}
+
+		void Epoch::enter()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				if (auto & slot = Epoch::slot(); slot.depth++ == 0)
+				{
+					slot.epoch.store(global_epoch.load());
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				catch_handler < epoch_exception > (logger, exception);
+			}
+		}
+
+		void Epoch::leave() noexcept
+		{
+			if (auto & slot = Epoch::slot(); --slot.depth == 0)
+			{
+				slot.epoch.store(idle, std::memory_order_release);
+			}
+		}
+
+		// slot of the calling thread, taken on its first guard and given back
+		// when the thread exits
+
+		Epoch::Slot & Epoch::slot()
+		{
+			struct Registration
+			{
+				~Registration() noexcept
+				{
+					if (slot)
+					{
+						slot->epoch.store(idle, std::memory_order_release);
+
+						slot->is_used.store(false, std::memory_order_release);
+					}
+				}
+
+				Slot * slot = nullptr;
+			};
+
+			thread_local Registration registration;
+
+			if (!registration.slot)
+			{
+				for (auto & slot : slots)
+				{
+					if (auto is_used = false; slot.is_used.compare_exchange_strong(is_used, true, std::memory_order_acq_rel))
+					{
+						slot.depth = 0;
+
+						registration.slot = &slot;
+
+						break;
+					}
+				}
+
+				if (!registration.slot)
+				{
+					throw epoch_exception("too many reading threads");
+				}
+			}
+
+			return *registration.slot;
+		}
+
+		// versions retired before the oldest announced epoch cannot be held by
+		// any reader, since readers announced later saw their replacements
+
+		void Epoch::reclaim()
+		{
+			auto oldest_epoch = idle;
+
+			for (const auto & slot : slots)
+			{
+				oldest_epoch = std::min(oldest_epoch, slot.epoch.load());
+			}
+
+			auto last = std::remove_if(std::begin(retired_versions), std::end(retired_versions),
+				[oldest_epoch](const auto & retired_version)
+			{
+				return (retired_version.first < oldest_epoch);
+			});
+
+			retired_versions.erase(last, std::end(retired_versions));
+		}
+
+	} // namespace shared
+
+} // namespace solution
\ No newline at end of file
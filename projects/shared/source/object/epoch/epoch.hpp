@@ -0,0 +1,144 @@
+#ifndef SOLUTION_SHARED_OBJECT_EPOCH_HPP
+#define SOLUTION_SHARED_OBJECT_EPOCH_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../logger/logger.hpp"
+
+namespace solution
+{
+	namespace shared
+	{
+		class epoch_exception : public std::exception
+		{
+		public:
+
+			explicit epoch_exception(const std::string & message) noexcept :
+				std::exception(message.c_str())
+			{}
+
+			explicit epoch_exception(const char * const message) noexcept :
+				std::exception(message)
+			{}
+
+			~epoch_exception() noexcept = default;
+		};
+
+		// epoch based reclamation of versions replaced by writers: a reader
+		// announces the global epoch in a slot of its thread while it holds a
+		// version, a writer retires the replaced version with the epoch it
+		// advanced from and frees it once no slot announces an epoch as old,
+		// readers never take locks and writers never wait for readers
+
+		class Epoch
+		{
+		public:
+
+			using epoch_t = std::uint64_t;
+
+			using retired_t = std::unique_ptr < const void, void (*)(const void *) > ;
+
+		public:
+
+			static constexpr std::size_t capacity = 256U; // of threads reading at once
+
+		private:
+
+			static constexpr epoch_t idle = std::numeric_limits < epoch_t > ::max();
+
+			static constexpr std::size_t threshold = 64U; // retired versions before reclamation
+
+		private:
+
+			struct alignas(64) Slot
+			{
+				std::atomic < epoch_t > epoch { idle };
+
+				std::atomic < bool > is_used { false };
+
+				std::size_t depth = 0; // of nested guards, only the owner thread touches it
+			};
+
+		private:
+
+			using retired_container_t = std::vector < std::pair < epoch_t, retired_t > > ;
+
+		public:
+
+			class Guard
+			{
+			public:
+
+				Guard()
+				{
+					Epoch::enter();
+				}
+
+				~Guard() noexcept
+				{
+					Epoch::leave();
+				}
+
+			private:
+
+				Guard			(const Guard &) = delete;
+				Guard & operator=(const Guard &) = delete;
+			};
+
+		public:
+
+			template < typename T >
+			static void retire(const T * pointer)
+			{
+				retire(retired_t(pointer, [](const void * pointer)
+				{
+					delete static_cast < const T * > (pointer);
+				}));
+			}
+
+			static void retire(retired_t retired);
+
+		private:
+
+			static void enter();
+
+			static void leave() noexcept;
+
+			static Slot & slot();
+
+			static void reclaim();
+
+		private:
+
+			static std::atomic < epoch_t > global_epoch;
+
+			static Slot slots[capacity];
+
+			static std::mutex retired_mutex;
+
+			static retired_container_t retired_versions;
+		};
+
+	} // namespace shared
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SHARED_OBJECT_EPOCH_HPP
\ No newline at end of file
@@ -1,16 +1,80 @@
 #include "object.hpp"
 
+#include "epoch/epoch.hpp"
+
 namespace solution
 {
 	namespace shared
 	{
+		Object::data_t Object::data() const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Epoch::Guard guard;
+
+				return *m_version.load();
+			}
+			catch (const std::exception & exception)
+			{
+				catch_handler < object_exception > (logger, exception);
+			}
+		}
+
 		void Object::update(data_t data)
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				m_data = std::move(data);
+				if (m_history_capacity.load(std::memory_order_relaxed) == 0)
+				{
+					Epoch::retire(m_version.exchange(new const data_t(std::move(data))));
+				}
+				else
+				{
+					std::scoped_lock < mutex_t > lock(m_history_mutex);
+
+					append(data);
+
+					Epoch::retire(m_version.exchange(new const data_t(std::move(data))));
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				catch_handler < object_exception > (logger, exception);
+			}
+		}
+
+		void Object::set_history(std::size_t capacity)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::scoped_lock < mutex_t > lock(m_history_mutex);
+
+				const auto size = std::min(m_size, capacity);
+
+				samples_container_t samples;
+
+				samples.reserve(capacity);
+
+				for (auto index = m_size - size; index < m_size; ++index)
+				{
+					samples.push_back(sample(index));
+				}
+
+				samples.resize(capacity);
+
+				m_samples = std::move(samples);
+
+				m_first = 0;
+
+				m_size = size;
+
+				m_history_capacity.store(capacity, std::memory_order_relaxed);
 			}
 			catch (const std::exception & exception)
 			{
@@ -18,6 +82,104 @@ namespace solution
 			}
 		}
 
+		void Object::get_range(timestamp_t begin, timestamp_t end, samples_container_t & samples) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				samples.clear();
+
+				std::scoped_lock < mutex_t > lock(m_history_mutex);
+
+				auto lower_bound = [this](timestamp_t timestamp) // timestamps increase from the oldest sample
+				{
+					std::size_t first = 0, size = m_size;
+
+					while (size > 0)
+					{
+						const auto step = size / 2U;
+
+						if (sample(first + step).timestamp < timestamp)
+						{
+							first += step + 1U;
+
+							size -= step + 1U;
+						}
+						else
+						{
+							size = step;
+						}
+					}
+
+					return first;
+				};
+
+				const auto first = lower_bound(begin);
+				const auto last  = std::max(first, lower_bound(end));
+
+				samples.reserve(last - first);
+
+				for (auto index = first; index < last; ++index)
+				{
+					samples.push_back(sample(index));
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				catch_handler < object_exception > (logger, exception);
+			}
+		}
+
+		void Object::get_last(std::size_t size, samples_container_t & samples) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				samples.clear();
+
+				std::scoped_lock < mutex_t > lock(m_history_mutex);
+
+				size = std::min(size, m_size);
+
+				samples.reserve(size);
+
+				for (auto index = m_size - size; index < m_size; ++index)
+				{
+					samples.push_back(sample(index));
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				catch_handler < object_exception > (logger, exception);
+			}
+		}
+
+		void Object::append(const data_t & data)
+		{
+			if (std::empty(m_samples))
+			{
+				return;
+			}
+
+			const auto now = std::chrono::duration_cast < std::chrono::nanoseconds > (
+				std::chrono::system_clock::now().time_since_epoch()).count();
+
+			m_last_timestamp = std::max(static_cast < timestamp_t > (now), m_last_timestamp + 1);
+
+			if (m_size < std::size(m_samples))
+			{
+				m_samples[(m_first + m_size++) % std::size(m_samples)] = Sample { m_last_timestamp, data };
+			}
+			else
+			{
+				m_samples[m_first] = Sample { m_last_timestamp, data };
+
+				m_first = (m_first + 1U) % std::size(m_samples);
+			}
+		}
+
 	} // namespace shared
 
 } // namespace solution
\ No newline at end of file
@@ -7,10 +7,21 @@
 #  pragma once
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <iterator>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
 
 #include "../config/config.hpp"
 #include "../logger/logger.hpp"
@@ -34,33 +45,110 @@ namespace solution
 			~object_exception() noexcept = default;
 		};
 
+		// value of an object is kept in its own type, numbers and short series
+		// are copied in and out of memory without formatting and parsing, each
+		// update publishes a new immutable version, readers copy the current one
+		// without locks and replaced versions are reclaimed by epochs, an object
+		// may also keep a bounded history of its latest versions with timestamps
+
 		class Object
 		{
 		public:
 
-			using data_t = std::string;
+			using vector_t = boost::container::small_vector < double, 4U > ;
+
+			using data_t = std::variant < double, std::int64_t, std::uint64_t, std::string, vector_t > ;
+
+			using timestamp_t = std::int64_t; // nanoseconds since epoch, increasing per object
+
+			struct Sample
+			{
+				timestamp_t timestamp;
+
+				data_t data;
+			};
+
+			using samples_container_t = std::vector < Sample > ;
+
+			using mutex_t = std::mutex;
 
 		public:
 
 			template < typename D, typename Enable = 
 				std::enable_if_t < std::is_convertible_v < D, data_t > > >
-			explicit Object(D && data) : m_data(std::forward < D > (data))
+			explicit Object(D && data) : m_version(new const data_t(std::forward < D > (data)))
 			{}
 
-			~Object() noexcept = default;
+			~Object() noexcept
+			{
+				delete m_version.load(std::memory_order_acquire);
+			}
+
+		private:
+
+			Object			 (const Object &) = delete;
+			Object & operator=(const Object &) = delete;
 
 		public:
 
-			const auto & data() const noexcept
+			data_t data() const;
+
+			void update(data_t data);
+
+			// writers that keep the order of updates somewhere else as well, like
+			// records of a journal, hold it around both, readers never take it
+
+			mutex_t & mutex() const noexcept
 			{
-				return m_data;
+				return m_mutex;
 			}
 
-			void update(data_t data);
+		public:
+
+			// history is off until a capacity is set, then each update is kept in
+			// a ring of samples stored side by side, the oldest ones are replaced
+			// when it is full and the newest ones survive a change of capacity,
+			// queries return samples from the oldest to the newest one
+
+			std::size_t history() const noexcept
+			{
+				return m_history_capacity.load(std::memory_order_relaxed);
+			}
+
+			void set_history(std::size_t capacity);
+
+			void get_range(timestamp_t begin, timestamp_t end, samples_container_t & samples) const; // [begin, end)
+
+			void get_last(std::size_t size, samples_container_t & samples) const;
 
 		private:
 
-			data_t m_data;
+			void append(const data_t & data);
+
+			const Sample & sample(std::size_t index) const noexcept // from the oldest one
+			{
+				return m_samples[(m_first + index) % std::size(m_samples)];
+			}
+
+		private:
+
+			std::atomic < const data_t * > m_version;
+
+			mutable mutex_t m_mutex; // of writers
+
+		private:
+
+			std::atomic < std::size_t > m_history_capacity { 0U };
+
+			samples_container_t m_samples;
+
+			std::size_t m_first = 0;
+
+			std::size_t m_size = 0;
+
+			timestamp_t m_last_timestamp = 0;
+
+			mutable mutex_t m_history_mutex;
 		};
 		
 	} // namespace shared
@@ -0,0 +1,557 @@
+#include "journal.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace memory
+		{
+			using Severity = shared::Logger::Severity;
+
+			void Journal::open(sequence_t sequence, const dictionary_t & dictionary)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					{
+						std::scoped_lock < std::mutex, std::mutex > lock(m_file_mutex, m_mutex);
+
+						if (m_is_open)
+						{
+							throw journal_exception("journal already opened");
+						}
+
+						open_file(sequence, dictionary);
+
+						m_is_open = true;
+
+						m_is_stopped = false;
+					}
+
+					m_thread = std::thread(&Journal::run, this);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			void Journal::close()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					{
+						std::scoped_lock < std::mutex > lock(m_mutex);
+
+						m_is_stopped = true;
+					}
+
+					m_condition.notify_one();
+
+					if (m_thread.joinable())
+					{
+						m_thread.join();
+					}
+
+					std::scoped_lock < std::mutex, std::mutex > lock(m_file_mutex, m_mutex);
+
+					if (m_is_open)
+					{
+						close_file();
+
+						m_is_open = false;
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			Journal::sequence_t Journal::rotate(const dictionary_t & dictionary)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::scoped_lock < std::mutex, std::mutex > lock(m_file_mutex, m_mutex);
+
+					if (!m_is_open)
+					{
+						throw journal_exception("journal not opened");
+					}
+
+					close_file();
+
+					open_file(m_sequence + 1U, dictionary);
+
+					return m_sequence;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			void Journal::remove_before(sequence_t sequence) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					for (const auto & file : files())
+					{
+						if (file.first < sequence)
+						{
+							boost::filesystem::remove(file.second);
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			void Journal::append_node(id_t id, const std::string & word)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					bool is_first = false;
+
+					{
+						std::scoped_lock < std::mutex > lock(m_mutex);
+
+						if (!m_is_open)
+						{
+							return;
+						}
+
+						is_first = (m_buffer.size() == 0);
+
+						encode(Kind::node, [this, id, &word]()
+						{
+							m_buffer.write(id);
+
+							m_buffer.write(word);
+						});
+					}
+
+					if (is_first)
+					{
+						m_condition.notify_one();
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			void Journal::remove_node(id_t id)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					bool is_first = false;
+
+					{
+						std::scoped_lock < std::mutex > lock(m_mutex);
+
+						if (!m_is_open)
+						{
+							return;
+						}
+
+						is_first = (m_buffer.size() == 0);
+
+						encode(Kind::removal, [this, id]()
+						{
+							m_buffer.write(id);
+						});
+					}
+
+					if (is_first)
+					{
+						m_condition.notify_one();
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			void Journal::set(const ids_container_t & ids, const data_t & data)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					bool is_signaled = false;
+
+					{
+						std::scoped_lock < std::mutex > lock(m_mutex);
+
+						if (!m_is_open)
+						{
+							return;
+						}
+
+						const auto size = m_buffer.size();
+
+						encode(Kind::set, [this, &ids, &data]()
+						{
+							m_buffer.write(static_cast < std::uint32_t > (std::size(ids)));
+
+							m_buffer.write(ids.data(), std::size(ids) * sizeof(id_t));
+
+							Snapshot::write(m_buffer, data);
+						});
+
+						is_signaled = (size == 0 || (size < commit_size && m_buffer.size() >= commit_size));
+					}
+
+					if (is_signaled)
+					{
+						m_condition.notify_one();
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			std::vector < std::pair < Journal::sequence_t, Journal::path_t > > Journal::files() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::vector < std::pair < sequence_t, path_t > > files;
+
+					if (!boost::filesystem::is_directory(m_directory))
+					{
+						return files;
+					}
+
+					for (const auto & entry : boost::filesystem::directory_iterator(m_directory))
+					{
+						const auto name = entry.path().filename().string();
+
+						if (std::size(name) > std::size(File::prefix) + std::size(File::extension) &&
+							name.compare(0, std::size(File::prefix), File::prefix) == 0 &&
+							name.compare(std::size(name) - std::size(File::extension), std::size(File::extension), File::extension) == 0)
+						{
+							const auto sequence = name.substr(std::size(File::prefix),
+								std::size(name) - std::size(File::prefix) - std::size(File::extension));
+
+							if (std::all_of(std::begin(sequence), std::end(sequence), [](auto c) { return (c >= '0' && c <= '9'); }))
+							{
+								files.emplace_back(std::stoull(sequence), entry.path());
+							}
+						}
+					}
+
+					std::sort(std::begin(files), std::end(files));
+
+					return files;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			void Journal::replay(const path_t & path, const handler_t & handler)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (boost::filesystem::file_size(path) < sizeof(Header))
+					{
+						return;
+					}
+
+					auto is_valid = true;
+
+					auto complete = sizeof(Header); // offset after the last complete record
+
+					auto end = complete;
+
+					{
+						boost::interprocess::file_mapping mapping(path.string().c_str(), boost::interprocess::read_only);
+
+						boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only);
+
+						const auto begin = static_cast < const char * > (region.get_address());
+
+						end = region.get_size();
+
+						Snapshot::Reader reader(begin, begin + end);
+
+						Header header;
+
+						reader.read(header);
+
+						if (const Header expected; !std::equal(std::begin(header.magic), std::end(header.magic), std::begin(expected.magic)) ||
+							header.version != expected.version)
+						{
+							is_valid = false;
+						}
+
+						Record record;
+
+						for (std::uint32_t size = 0; is_valid && complete < end; complete += sizeof(size) + size)
+						{
+							try
+							{
+								Snapshot::Reader prefix(begin + complete, begin + end);
+
+								prefix.read(size);
+
+								prefix.require(size);
+
+								Snapshot::Reader body(begin + complete + sizeof(size), begin + complete + sizeof(size) + size);
+
+								decode(body, record);
+
+								if (!body.is_empty())
+								{
+									throw journal_exception("record is longer than decoded");
+								}
+							}
+							catch (const std::exception & exception)
+							{
+								logger.write(Severity::error, "journal " + path.string() + " ends with a partial record: " + exception.what());
+
+								break;
+							}
+
+							handler(record);
+						}
+					}
+
+					if (!is_valid)
+					{
+						auto invalid_path = path; invalid_path += ".invalid";
+
+						boost::filesystem::rename(path, invalid_path);
+
+						logger.write(Severity::error, "file " + path.string() + " renamed to " + invalid_path.string());
+					}
+					else if (complete < end)
+					{
+						boost::filesystem::resize_file(path, complete);
+
+						logger.write(Severity::error, "journal " + path.string() + " truncated to " + std::to_string(complete) + " bytes");
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			void Journal::decode(Snapshot::Reader & reader, Record & record)
+			{
+				reader.read(record.kind);
+
+				switch (record.kind)
+				{
+				case Kind::node:
+				{
+					record.ids.resize(1U);
+
+					reader.read(record.ids.front());
+
+					reader.read(record.word);
+
+					break;
+				}
+				case Kind::removal:
+				{
+					record.ids.resize(1U);
+
+					reader.read(record.ids.front());
+
+					break;
+				}
+				case Kind::set:
+				{
+					std::uint32_t size = 0;
+
+					reader.read(size);
+
+					reader.require(size * sizeof(id_t));
+
+					record.ids.resize(size);
+
+					reader.read(record.ids.data(), size * sizeof(id_t));
+
+					Snapshot::read(reader, record.data);
+
+					break;
+				}
+				default:
+				{
+					throw journal_exception("unknown kind of record " + std::to_string(static_cast < int > (record.kind)));
+				}
+				}
+			}
+
+			Journal::path_t Journal::make_path(sequence_t sequence) const
+			{
+				auto path = m_directory; path /= File::prefix + std::to_string(sequence) + File::extension;
+
+				return path;
+			}
+
+			void Journal::open_file(sequence_t sequence, const dictionary_t & dictionary)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					boost::filesystem::create_directories(m_directory);
+
+					const auto path = make_path(sequence);
+
+					m_fout.open(path.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+					if (!m_fout)
+					{
+						throw journal_exception("cannot open file " + path.string());
+					}
+
+					Header header;
+
+					header.sequence = sequence;
+
+					if (!m_fout.write(reinterpret_cast < const char * > (&header), sizeof(header)) || !m_fout.flush())
+					{
+						throw journal_exception("cannot write file " + path.string());
+					}
+
+					m_sequence = sequence;
+
+					for (const auto & node : dictionary)
+					{
+						encode(Kind::node, [this, &node]()
+						{
+							m_buffer.write(node.first);
+
+							m_buffer.write(node.second);
+						});
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			void Journal::close_file()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					write(m_buffer);
+
+					m_fout.close();
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			void Journal::write(buffer_t & buffer)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (buffer.size() > 0)
+					{
+						if (!m_fout.write(buffer.buffer().data(), static_cast < std::streamsize > (buffer.size())) || !m_fout.flush())
+						{
+							throw journal_exception("cannot write journal " + std::to_string(m_sequence));
+						}
+
+						buffer.buffer().clear();
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+			// one group per wait: the first record wakes the thread, records
+			// that come during the commit period are written together with it
+
+			void Journal::run()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					for (auto is_stopped = false; !is_stopped; )
+					{
+						{
+							std::unique_lock < std::mutex > lock(m_mutex);
+
+							m_condition.wait(lock, [this]()
+							{
+								return (m_is_stopped || m_buffer.size() > 0);
+							});
+
+							m_condition.wait_for(lock, commit_period, [this]()
+							{
+								return (m_is_stopped || m_buffer.size() >= commit_size);
+							});
+
+							is_stopped = m_is_stopped;
+						}
+
+						try
+						{
+							std::scoped_lock < std::mutex > file_lock(m_file_mutex);
+
+							{
+								std::scoped_lock < std::mutex > lock(m_mutex);
+
+								std::swap(m_buffer, m_group);
+							}
+
+							write(m_group);
+						}
+						catch (const std::exception & exception)
+						{
+							logger.write(Severity::error, exception.what());
+
+							m_group.buffer().clear(); // records of the group are lost
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < journal_exception > (logger, exception);
+				}
+			}
+
+		} // namespace memory
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
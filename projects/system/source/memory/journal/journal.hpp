@@ -0,0 +1,265 @@
+#ifndef SOLUTION_SYSTEM_MEMORY_JOURNAL_HPP
+#define SOLUTION_SYSTEM_MEMORY_JOURNAL_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "../snapshot/snapshot.hpp"
+
+#include "../../../../shared/source/config/config.hpp"
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace memory
+		{
+			class journal_exception : public std::exception
+			{
+			public:
+
+				explicit journal_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit journal_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~journal_exception() noexcept = default;
+			};
+
+			// append-only log of changes of memory made since the last snapshot,
+			// writers only encode a record into a buffer under a short lock, a
+			// thread of the journal writes the buffer as one group every commit
+			// period or sooner when it fills, so a crash of the process loses no
+			// record older than the period, each file starts with the words of
+			// all nodes by id, ids of later records are translated through them
+			// on replay, since ids of words change from one run to another
+
+			class Journal
+			{
+			public:
+
+				using id_t = shared::Config::id_t;
+
+				using ids_container_t = shared::Config::ids_container_t;
+
+				using data_t = Snapshot::data_t;
+
+				using path_t = boost::filesystem::path;
+
+				using sequence_t = std::uint64_t; // of a file, files are replayed by increasing sequence
+
+				using dictionary_t = std::vector < std::pair < id_t, std::string > > ; // words of nodes by id
+
+			public:
+
+				struct Header
+				{
+					char magic[4] = { 'J', 'R', 'N', 'L' };
+
+					std::uint32_t version = 1U;
+
+					sequence_t sequence = 0;
+				};
+
+				static_assert(std::is_trivially_copyable_v < Header > , "Header is not trivially copyable");
+
+			public:
+
+				enum class Kind : std::uint8_t
+				{
+					node,
+					removal,
+					set
+				};
+
+				struct Record
+				{
+					Kind kind;
+
+					ids_container_t ids; // one id for nodes and removals
+
+					std::string word; // of nodes
+
+					data_t data; // of sets
+				};
+
+				using handler_t = std::function < void (const Record &) > ;
+
+			public:
+
+				struct File
+				{
+					static inline const std::string prefix = "memory.";
+
+					static inline const std::string extension = ".journal";
+				};
+
+			private:
+
+				using buffer_t = Snapshot::Writer;
+
+			public:
+
+				explicit Journal(const path_t & directory) : m_directory(directory)
+				{}
+
+				~Journal() noexcept
+				{
+					try
+					{
+						close();
+					}
+					catch (...)
+					{
+						// std::abort();
+					}
+				}
+
+			private:
+
+				Journal			   (const Journal &) = delete;
+				Journal & operator=(const Journal &) = delete;
+
+			public:
+
+				void open(sequence_t sequence, const dictionary_t & dictionary);
+
+				void close();
+
+				// closes the current file and starts the next one, returns its
+				// sequence, earlier files may be removed once a snapshot taken
+				// after the rotation is written
+
+				sequence_t rotate(const dictionary_t & dictionary);
+
+				void remove_before(sequence_t sequence) const;
+
+			public:
+
+				// records are dropped while the journal is not open, so nothing
+				// is written back while memory is loaded or replayed
+
+				void append_node(id_t id, const std::string & word);
+
+				void remove_node(id_t id);
+
+				// writers of one object hold its own lock around the update and
+				// the record, so records follow the order of updates of the object
+
+				void set(const ids_container_t & ids, const data_t & data);
+
+			public:
+
+				// sequences of files in the directory in the order of replay
+
+				std::vector < std::pair < sequence_t, path_t > > files() const;
+
+				// a record cut by a crash or not decoded ends the replay of its
+				// file, which is truncated after the last complete record, a file
+				// with an invalid header is renamed aside, neither stops startup
+
+				static void replay(const path_t & path, const handler_t & handler);
+
+			private:
+
+				path_t make_path(sequence_t sequence) const;
+
+				void open_file(sequence_t sequence, const dictionary_t & dictionary);
+
+				void close_file();
+
+				void encode_dictionary(const dictionary_t & dictionary);
+
+				static void decode(Snapshot::Reader & reader, Record & record);
+
+				template < typename F >
+				void encode(Kind kind, F && f)
+				{
+					// size of the record is written after its body is encoded
+
+					const auto begin = m_buffer.size();
+
+					m_buffer.write(std::uint32_t(0));
+
+					m_buffer.write(kind);
+
+					f();
+
+					const auto size = static_cast < std::uint32_t > (m_buffer.size() - begin - sizeof(std::uint32_t));
+
+					std::memcpy(m_buffer.buffer().data() + begin, &size, sizeof(size));
+				}
+
+				void write(buffer_t & buffer);
+
+				void run();
+
+			private:
+
+				static inline const std::chrono::milliseconds commit_period = std::chrono::milliseconds(5);
+
+				static constexpr std::size_t commit_size = 1U << 20U; // of buffer waking the writer early
+
+			private:
+
+				const path_t m_directory;
+
+			private:
+
+				buffer_t m_buffer; // of records not yet written
+
+				buffer_t m_group; // owned by the writer thread
+
+				std::ofstream m_fout;
+
+				sequence_t m_sequence = 0;
+
+				bool m_is_open = false;
+
+				bool m_is_stopped = false;
+
+			private:
+
+				std::mutex m_mutex; // of the buffer, taken by writers of records
+
+				std::mutex m_file_mutex; // of the file, taken before m_mutex
+
+				std::condition_variable m_condition;
+
+				std::thread m_thread;
+			};
+
+		} // namespace memory
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MEMORY_JOURNAL_HPP
\ No newline at end of file
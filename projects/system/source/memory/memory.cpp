@@ -4,7 +4,7 @@ namespace solution
 {
 	namespace system
 	{
-		void Memory::Data::load(      nodes_container_t & nodes)
+		void Memory::Data::load(      words_container_t & words)
 		{
 			RUN_LOGGER(logger);
 
@@ -16,11 +16,7 @@ namespace solution
 
 				for (const auto & element : array)
 				{
-					auto word = element[Key::Node::word].get < std::string > ();
-
-					auto node = std::make_shared < Node > (std::move(word));
-
-					nodes[node->word()] = node;
+					words.push_back(element[Key::Node::word].get < std::string > ());
 				}
 			}
 			catch (const std::exception & exception)
@@ -39,11 +35,14 @@ namespace solution
 
 				for (const auto & node : nodes)
 				{
-					json_t element;
+					if (node)
+					{
+						json_t element;
 
-					element[Key::Node::word] = node.second->word();
+						element[Key::Node::word] = node->word();
 
-					array.push_back(element);
+						array.push_back(element);
+					}
 				}
 
 				save(File::nodes_data, array);
@@ -54,6 +53,34 @@ namespace solution
 			}
 		}
 
+		bool Memory::Data::load(      Snapshot::words_container_t & words,       Snapshot::entries_container_t & entries)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				return Snapshot::load(File::memory_snapshot, words, entries);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::Data::save(const Snapshot::words_container_t & words, const Snapshot::entries_container_t & entries)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Snapshot::save(File::memory_snapshot, words, entries);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
 		void Memory::Data::load(const path_t & path,       json_t & object)
 		{
 			RUN_LOGGER(logger);
@@ -103,6 +130,8 @@ namespace solution
 			try
 			{
 				load();
+
+				m_snapshot_thread = std::thread(&Memory::run_snapshots, this);
 			}
 			catch (const std::exception & exception)
 			{
@@ -116,6 +145,19 @@ namespace solution
 
 			try
 			{
+				{
+					std::scoped_lock < std::mutex > lock(m_snapshot_mutex);
+
+					m_is_stopped = true;
+				}
+
+				m_snapshot_condition.notify_one();
+
+				if (m_snapshot_thread.joinable())
+				{
+					m_snapshot_thread.join();
+				}
+
 				save();
 			}
 			catch (const std::exception & exception)
@@ -131,6 +173,10 @@ namespace solution
 			try
 			{
 				load_nodes();
+
+				load_objects();
+
+				replay_journal();
 			}
 			catch (const std::exception & exception)
 			{
@@ -144,6 +190,8 @@ namespace solution
 			try
 			{
 				save_nodes();
+
+				compact();
 			}
 			catch (const std::exception & exception)
 			{
@@ -157,7 +205,11 @@ namespace solution
 
 			try
 			{
-				Data::load(m_nodes);
+				words_container_t words;
+
+				Data::load(words);
+
+				check_and_append_nodes(words);
 			}
 			catch (const std::exception & exception)
 			{
@@ -179,20 +231,50 @@ namespace solution
 			}
 		}
 
-		void Memory::append_node(const std::string & word)
+		// objects are made in the order of the snapshot, which is the order of
+		// their old ids, so nodes are appended to at their ends as before
+
+		void Memory::load_objects()
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				std::scoped_lock < mutex_t > lock(m_lingual_mutex);
+				Snapshot::words_container_t words;
 
-				if (m_nodes.count(word) != 0)
+				Snapshot::entries_container_t entries;
+
+				if (!Data::load(words, entries))
 				{
-					throw memory_exception("node " + word + " already existed");
+					return;
 				}
 
-				m_nodes[word] = std::make_shared < Node > (word);
+				check_and_append_nodes(words);
+
+				ids_container_t words_ids;
+
+				intern_implementation(words, words_ids);
+
+				ids_container_t ids;
+
+				for (const auto & entry : entries)
+				{
+					ids.clear();
+
+					for (auto position : entry.positions)
+					{
+						ids.push_back(words_ids[position]);
+					}
+
+					std::sort(std::begin(ids), std::end(ids));
+
+					ids.erase(std::unique(std::begin(ids), std::end(ids)), std::end(ids));
+
+					if (!ids.empty())
+					{
+						make_object(ids, entry.data);
+					}
+				}
 			}
 			catch (const std::exception & exception)
 			{
@@ -200,15 +282,77 @@ namespace solution
 			}
 		}
 
-		void Memory::remove_node(const std::string & word)
+		// all nodes are locked shared only to copy ids and pointers of objects,
+		// so no object is seen in some of its nodes and not in others, values
+		// are read and the file is written after the locks are released
+
+		void Memory::save_objects() const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				std::scoped_lock < mutex_t, mutex_t > lock(m_objects_mutex, m_lingual_mutex);
+				using position_t = Snapshot::position_t;
+
+				std::vector < std::tuple < object_id_t, position_t, std::shared_ptr < Object > > > memberships;
+
+				Snapshot::words_container_t words;
+
+				{
+					std::shared_lock < mutex_t > lingual_lock(m_lingual_mutex);
 
-				m_nodes.erase(word);
+					std::vector < std::shared_lock < mutex_t > > locks;
+
+					locks.reserve(std::size(m_nodes));
+
+					for (const auto & node : m_nodes) // by increasing id, as views lock them
+					{
+						if (node)
+						{
+							locks.emplace_back(node->objects_mutex());
+						}
+					}
+
+					for (const auto & node : m_nodes)
+					{
+						if (node)
+						{
+							const auto position = static_cast < position_t > (std::size(words));
+
+							words.push_back(node->word());
+
+							for (std::size_t i = 0; i < std::size(node->object_ids()); ++i)
+							{
+								memberships.emplace_back(node->object_ids()[i], position, node->objects()[i]);
+							}
+						}
+					}
+				}
+
+				std::sort(std::begin(memberships), std::end(memberships), [](const auto & lhs, const auto & rhs)
+				{
+					return (std::tie(std::get < 0 > (lhs), std::get < 1 > (lhs)) < std::tie(std::get < 0 > (rhs), std::get < 1 > (rhs)));
+				});
+
+				Snapshot::entries_container_t entries;
+
+				for (std::size_t i = 0; i < std::size(memberships); )
+				{
+					const auto object_id = std::get < 0 > (memberships[i]);
+
+					Snapshot::Entry entry;
+
+					entry.data = std::get < 2 > (memberships[i])->data();
+
+					for (; i < std::size(memberships) && std::get < 0 > (memberships[i]) == object_id; ++i)
+					{
+						entry.positions.push_back(std::get < 1 > (memberships[i]));
+					}
+
+					entries.push_back(std::move(entry));
+				}
+
+				Data::save(words, entries);
 			}
 			catch (const std::exception & exception)
 			{
@@ -216,75 +360,359 @@ namespace solution
 			}
 		}
 
-		void Memory::get_implementation(const words_container_t & words,       data_t & data) const
+		// files of the journal are replayed in order over the snapshot, records
+		// already in the snapshot are applied again with the same result, then
+		// the next file is started, older files stay until the next compaction
+
+		void Memory::replay_journal()
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				switch (words.size())
-				{
-				case 0:
+				const auto files = m_journal.files();
+
+				for (const auto & file : files)
 				{
-					throw memory_exception("empty words container");
+					std::unordered_map < id_t, id_t > ids; // of nodes in the file to ids of nodes now
 
-					break;
+					Journal::replay(file.second, [this, &logger, &ids](const Journal::Record & record)
+					{
+						try
+						{
+							switch (record.kind)
+							{
+							case Journal::Kind::node:
+							{
+								if (const auto id = m_symbols.find(record.word); id >= std::size(m_nodes) || !m_nodes[id])
+								{
+									append_node(record.word);
+								}
+
+								ids[record.ids.front()] = m_symbols.find(record.word);
+
+								break;
+							}
+							case Journal::Kind::removal:
+							{
+								if (auto iterator = ids.find(record.ids.front()); iterator != std::end(ids))
+								{
+									if (iterator->second < std::size(m_nodes) && m_nodes[iterator->second])
+									{
+										remove_node(m_nodes[iterator->second]->word());
+									}
+
+									ids.erase(iterator);
+								}
+
+								break;
+							}
+							case Journal::Kind::set:
+							{
+								ids_container_t key;
+
+								for (auto id : record.ids)
+								{
+									if (auto iterator = ids.find(id); iterator != std::end(ids))
+									{
+										key.push_back(iterator->second);
+									}
+									else
+									{
+										throw memory_exception("node " + std::to_string(id) + " of journal not found");
+									}
+								}
+
+								set_implementation(key, record.data);
+
+								break;
+							}
+							}
+						}
+						catch (const std::exception & exception)
+						{
+							logger.write(shared::Logger::Severity::error, exception.what());
+						}
+					});
 				}
-				case 1:
+
+				m_journal.open((files.empty() ? 0U : files.back().first + 1U), make_dictionary());
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		// the journal is rotated before the snapshot is taken, so every change
+		// of earlier files is in the snapshot and they can be removed after it
+
+		void Memory::compact()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Journal::sequence_t sequence = 0;
+
 				{
-					auto node = m_nodes.at(words.at(0));
+					std::shared_lock < mutex_t > lock(m_lingual_mutex);
 
-					switch (node->objects().size())
-					{
-					case 0:
-					{
-						throw memory_exception("object not found");
+					sequence = m_journal.rotate(make_dictionary());
+				}
 
-						break;
-					}
-					case 1:
+				save_objects();
+
+				m_journal.remove_before(sequence);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::run_snapshots()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				for (;;)
+				{
 					{
-						data = (*(std::begin(node->objects())))->data();
+						std::unique_lock < std::mutex > lock(m_snapshot_mutex);
 
-						break;
+						if (m_snapshot_condition.wait_for(lock, snapshot_period, [this]() { return m_is_stopped; }))
+						{
+							break;
+						}
 					}
-					default:
-					{
-						throw memory_exception("ambiguous object choice");
 
-						break;
+					try
+					{
+						compact();
 					}
+					catch (const std::exception & exception)
+					{
+						logger.write(shared::Logger::Severity::error, exception.what());
 					}
-					break;
 				}
-				default:
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::append_node(const std::string & word)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::scoped_lock < mutex_t > lock(m_lingual_mutex);
+
+				const auto id = m_symbols.intern(word);
+
+				if (id >= std::size(m_nodes))
 				{
-					objects_container_t intersection = find_intersection(words);
+					m_nodes.resize(id + 1U);
+				}
 
-					switch (intersection.size())
-					{
-					case 0:
-					{
-						throw memory_exception("empty intersection");
+				if (m_nodes[id])
+				{
+					throw memory_exception("node " + word + " already existed");
+				}
 
-						break;
-					}
-					case 1:
+				m_nodes[id] = std::make_shared < Node > (word);
+
+				m_journal.append_node(id, word);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::remove_node(const std::string & word)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::scoped_lock < mutex_t, mutex_t > lock(m_objects_mutex, m_lingual_mutex);
+
+				if (const auto id = m_symbols.find(word); id < std::size(m_nodes) && m_nodes[id])
+				{
+					m_nodes[id].reset();
+
+					m_generation.fetch_add(1U, std::memory_order_release);
+
+					m_journal.remove_node(id);
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::intern_implementation(const words_container_t & words, ids_container_t & ids) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				for (const auto & word : words)
+				{
+					const auto id = m_symbols.find(word);
+
+					if (id >= std::size(m_nodes) || !m_nodes[id])
 					{
-						data = (*(std::begin(intersection)))->data();
+						throw memory_exception("node " + word + " not found");
+					}
 
-						break;
+					ids.push_back(id);
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::acquire_implementation(bool is_unique, const ids_container_t & ids) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				for (auto id : ids)
+				{
+					if (is_unique)
+					{
+						node(id)->objects_mutex().lock();
 					}
-					default:
+					else
 					{
-						throw memory_exception("ambiguous object choice in intersection");
+						node(id)->objects_mutex().lock_shared();
+					}
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
 
-						break;
+		void Memory::release_implementation(bool is_unique, const ids_container_t & ids) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				for (auto id : ids)
+				{
+					if (is_unique)
+					{
+						node(id)->objects_mutex().unlock();
 					}
+					else
+					{
+						node(id)->objects_mutex().unlock_shared();
 					}
-					break;
 				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::get_implementation(const ids_container_t & ids,       data_t & data) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				auto object = find_object(ids);
+
+				if (!object)
+				{
+					throw memory_exception("object not found");
+				}
+
+				data = object->data();
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::set_implementation(const ids_container_t & ids, const data_t & data)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				if (auto object = find_object(ids); object)
+				{
+					std::scoped_lock < Object::mutex_t > lock(object->mutex());
+
+					object->update(data);
+
+					m_journal.set(ids, data);
+				}
+				else
+				{
+					make_object(ids, data); // not reachable by other writers before the nodes are released
+
+					m_journal.set(ids, data);
+				}
+
+				notify(ids);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::resolve_implementation(const ids_container_t & ids, const data_t * data, std::shared_ptr < Object > & object)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				object = find_object(ids);
+
+				if (!object && data)
+				{
+					object = make_object(ids, *data); // with the value of its first write, never a placeholder
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		void Memory::store_implementation(const ids_container_t & ids, Object & object, const data_t & data)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				{
+					std::scoped_lock < Object::mutex_t > lock(object.mutex()); // handles do not lock nodes
+
+					object.update(data);
+
+					m_journal.set(ids, data);
 				}
+
+				notify(ids);
 			}
 			catch (const std::exception & exception)
 			{
@@ -292,13 +720,33 @@ namespace solution
 			}
 		}
 
-		void Memory::set_implementation(const words_container_t & words, const data_t & data)
+		void Memory::subscribe_implementation(const ids_container_t & ids, std::shared_ptr < Subscription > & subscription)
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				switch (words.size())
+				subscription = std::make_shared < Subscription > (ids);
+
+				std::scoped_lock < std::mutex > lock(m_subscriptions_mutex);
+
+				m_subscriptions.push_back(subscription);
+
+				m_subscriptions_size.store(std::size(m_subscriptions), std::memory_order_release);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		std::shared_ptr < Memory::Object > Memory::find_object(const ids_container_t & ids) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				switch (ids.size())
 				{
 				case 0:
 				{
@@ -308,21 +756,17 @@ namespace solution
 				}
 				case 1:
 				{
-					auto node = m_nodes.at(words.at(0));
+					const auto & objects = node(ids.front())->objects();
 
-					switch (node->objects().size())
+					switch (objects.size())
 					{
 					case 0:
 					{
-						node->append(std::make_shared < Node::Object > (data));
-
-						break;
+						return nullptr;
 					}
 					case 1:
 					{
-						(*(std::begin(node->objects())))->update(data);
-
-						break;
+						return *(std::begin(objects));
 					}
 					default:
 					{
@@ -335,26 +779,17 @@ namespace solution
 				}
 				default:
 				{
-					objects_container_t intersection = find_intersection(words);
+					objects_container_t intersection = find_intersection(ids, 2U);
 
 					switch (intersection.size())
 					{
 					case 0:
 					{
-						auto object = std::make_shared < Node::Object > (data);
-
-						for (const auto & word : words)
-						{
-							m_nodes.at(word)->append(object);
-						}
-
-						break;
+						return nullptr;
 					}
 					case 1:
 					{
-						(*(std::begin(intersection)))->update(data);
-
-						break;
+						return *(std::begin(intersection));
 					}
 					default:
 					{
@@ -373,6 +808,29 @@ namespace solution
 			}
 		}
 
+		std::shared_ptr < Memory::Object > Memory::make_object(const ids_container_t & ids, const data_t & data)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				auto object = std::make_shared < Object > (data);
+
+				const auto object_id = m_object_id.fetch_add(1U, std::memory_order_relaxed);
+
+				for (auto id : ids)
+				{
+					node(id)->append(object_id, object);
+				}
+
+				return object;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
 		void Memory::check_and_append_nodes(const words_container_t & words)
 		{
 			RUN_LOGGER(logger);
@@ -381,7 +839,7 @@ namespace solution
 			{
 				for (const auto & word : words)
 				{
-					if (!m_nodes.count(word))
+					if (auto id = m_symbols.find(word); id >= std::size(m_nodes) || !m_nodes[id])
 					{
 						append_node(word);
 					}
@@ -393,32 +851,59 @@ namespace solution
 			}
 		}
 
-		Memory::objects_container_t Memory::find_intersection(const words_container_t & words) const
+		const std::shared_ptr < Memory::Node > & Memory::node(id_t id) const
+		{
+			if (id >= std::size(m_nodes) || !m_nodes[id])
+			{
+				throw memory_exception("node " + std::to_string(id) + " not found");
+			}
+
+			return m_nodes[id];
+		}
+
+		// ids of the smallest node are candidates, the other nodes are checked
+		// from smallest to largest, by bitmap or by galloping from the last
+		// position, search stops at the end of any node or after limit objects
+
+		Memory::objects_container_t Memory::find_intersection(const ids_container_t & ids, std::size_t limit) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				auto basic_word = std::min_element(std::begin(words), std::end(words),
-					[this](const auto & lhs_word, const auto & rhs_word)
+				boost::container::small_vector < const Node *, 8U > nodes;
+
+				for (auto id : ids)
 				{
-					return (m_nodes.at(lhs_word)->objects().size() < m_nodes.at(rhs_word)->objects().size());
+					nodes.push_back(node(id).get());
+				}
+
+				std::sort(std::begin(nodes), std::end(nodes), [](auto lhs, auto rhs)
+				{
+					return (lhs->object_ids().size() < rhs->object_ids().size());
 				});
 
-				auto basic_node = m_nodes.at(*basic_word);
+				boost::container::small_vector < std::size_t, 8U > positions(nodes.size(), 0U);
 
-				auto flag = true;
+				const auto & basic_object_ids = nodes.front()->object_ids();
 
 				objects_container_t intersection;
 
-				for (const auto & object : basic_node->objects())
+				for (std::size_t i = 0; i < basic_object_ids.size(); ++i)
 				{
-					flag = true;
+					const auto object_id = basic_object_ids[i];
+
+					auto flag = true;
 
-					for (const auto & word : words)
+					for (std::size_t j = 1; j < nodes.size(); ++j)
 					{
-						if (!(m_nodes.at(word)->objects().count(object)))
+						if (!nodes[j]->contains(object_id, positions[j]))
 						{
+							if (positions[j] == nodes[j]->object_ids().size())
+							{
+								return intersection;
+							}
+
 							flag = false;
 
 							break;
@@ -427,7 +912,12 @@ namespace solution
 
 					if (flag)
 					{
-						intersection.insert(object);
+						intersection.push_back(nodes.front()->objects()[i]);
+
+						if (intersection.size() == limit)
+						{
+							break;
+						}
 					}
 				}
 
@@ -439,6 +929,75 @@ namespace solution
 			}
 		}
 
+		// written key is matched as given, subscriptions no longer referenced
+		// by readers are dropped on the way
+
+		void Memory::notify(const ids_container_t & ids)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				if (m_subscriptions_size.load(std::memory_order_acquire) == 0)
+				{
+					return;
+				}
+
+				auto key = ids;
+
+				std::sort(std::begin(key), std::end(key));
+
+				key.erase(std::unique(std::begin(key), std::end(key)), std::end(key));
+
+				std::scoped_lock < std::mutex > lock(m_subscriptions_mutex);
+
+				auto last = std::remove_if(std::begin(m_subscriptions), std::end(m_subscriptions),
+					[&key](const auto & weak_subscription)
+				{
+					auto subscription = weak_subscription.lock();
+
+					if (subscription && subscription->matches(key))
+					{
+						subscription->notify(key);
+					}
+
+					return !subscription;
+				});
+
+				m_subscriptions.erase(last, std::end(m_subscriptions));
+
+				m_subscriptions_size.store(std::size(m_subscriptions), std::memory_order_release);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
+		Memory::Journal::dictionary_t Memory::make_dictionary() const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Journal::dictionary_t dictionary;
+
+				for (id_t id = 0; id < std::size(m_nodes); ++id)
+				{
+					if (m_nodes[id])
+					{
+						dictionary.emplace_back(id, m_nodes[id]->word());
+					}
+				}
+
+				return dictionary;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < memory_exception > (logger, exception);
+			}
+		}
+
 	} // namespace system
 
 } // namespace solution
\ No newline at end of file
@@ -8,6 +8,11 @@
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <fstream>
 #include <iterator>
@@ -17,16 +22,25 @@
 #include <shared_mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <boost/container/small_vector.hpp>
 #include <boost/extended/serialization/json.hpp>
 #include <boost/filesystem/path.hpp>
 
+#include "journal/journal.hpp"
 #include "node/node.hpp"
+#include "snapshot/snapshot.hpp"
+#include "symbols/symbols.hpp"
 
 #include "../../../shared/source/config/config.hpp"
 #include "../../../shared/source/logger/logger.hpp"
+#include "../../../shared/source/memory/subscription/subscription.hpp"
 
 namespace solution
 {
@@ -50,6 +64,8 @@ namespace solution
 		namespace memory
 		{
 			class View;
+
+			class Direct_View;
 		}
 
 		class Memory
@@ -59,23 +75,44 @@ namespace solution
 			using View = memory::View;
 			using Node = memory::Node; 
 
-			using nodes_container_t = 
-				std::unordered_map < std::string, std::shared_ptr < Node > > ;
+			using Symbols = memory::Symbols;
+
+			using Snapshot = memory::Snapshot;
+
+			using Journal = memory::Journal;
+
+			using nodes_container_t = std::vector < std::shared_ptr < Node > > ; // by id of word
+
+			using Object = Node::Object;
+
+			using object_id_t = Node::object_id_t;
 
 			using objects_container_t = Node::objects_container_t;
 
+			using Subscription = shared::memory::Subscription;
+
+			using subscriptions_container_t = std::vector < std::weak_ptr < Subscription > > ;
+
 			using mutex_t = std::shared_mutex;
 
 		public:
 
 			using words_container_t = shared::Config::words_container_t;
 
+			using id_t = shared::Config::id_t;
+
+			using ids_container_t = shared::Config::ids_container_t;
+
 			using data_t = shared::Object::data_t;
 
+			using generation_t = std::uint64_t;
+
 		private:
 
 			friend class View;
 
+			friend class memory::Direct_View;
+
 		private:
 
 			class Data
@@ -84,13 +121,17 @@ namespace solution
 
 				using json_t = boost::extended::serialization::json;
 
-			private:
+			public:
 
 				struct File
 				{
 					using path_t = boost::filesystem::path;
 
 					static inline const path_t nodes_data = "memory/data/nodes.data";
+
+					static inline const path_t memory_snapshot = "memory/data/memory.snapshot";
+
+					static inline const path_t journal_directory = "memory/data";
 				};
 
 			private:
@@ -109,9 +150,13 @@ namespace solution
 
 			public:
 
-				static void load(	   nodes_container_t & actions);
+				static void load(	   words_container_t & words);
+
+				static void save(const nodes_container_t & nodes);
 
-				static void save(const nodes_container_t & actions);
+				static bool load(	   Snapshot::words_container_t & words,       Snapshot::entries_container_t & entries);
+
+				static void save(const Snapshot::words_container_t & words, const Snapshot::entries_container_t & entries);
 
 			private:
 
@@ -122,7 +167,7 @@ namespace solution
 
 		public:
 
-			Memory()
+			Memory() : m_journal(Data::File::journal_directory)
 			{
 				initialize();
 			}
@@ -157,6 +202,18 @@ namespace solution
 
 			void save_nodes();
 
+		private:
+
+			void load_objects();
+
+			void save_objects() const;
+
+			void replay_journal();
+
+			void compact();
+
+			void run_snapshots();
+
 		public:
 
 			void append_node(const std::string & word);
@@ -165,24 +222,86 @@ namespace solution
 
 		private:
 
-			void get_implementation(const words_container_t & words,       data_t & data) const;
+			void intern_implementation(const words_container_t & words, ids_container_t & ids) const;
+
+			void acquire_implementation(bool is_unique, const ids_container_t & ids) const;
+
+			void release_implementation(bool is_unique, const ids_container_t & ids) const;
+
+			void get_implementation(const ids_container_t & ids,       data_t & data) const;
 			
-			void set_implementation(const words_container_t & words, const data_t & data);
+			void set_implementation(const ids_container_t & ids, const data_t & data);
+
+			void resolve_implementation(const ids_container_t & ids, const data_t * data, std::shared_ptr < Object > & object);
+
+			auto generation_implementation() const noexcept
+			{
+				return m_generation.load(std::memory_order_acquire);
+			}
+
+			void store_implementation(const ids_container_t & ids, Object & object, const data_t & data);
+
+			void subscribe_implementation(const ids_container_t & ids, std::shared_ptr < Subscription > & subscription);
 
 		private:
 
 			void check_and_append_nodes(const words_container_t & words);
 
-			objects_container_t find_intersection(const words_container_t & words) const;
+			std::shared_ptr < Object > find_object(const ids_container_t & ids) const;
+
+			std::shared_ptr < Object > make_object(const ids_container_t & ids, const data_t & data);
+
+			const std::shared_ptr < Node > & node(id_t id) const;
+
+			objects_container_t find_intersection(const ids_container_t & ids, std::size_t limit) const;
+
+			void notify(const ids_container_t & ids);
+
+			Journal::dictionary_t make_dictionary() const;
 
 		private:
 
+			Symbols m_symbols;
+
 			nodes_container_t m_nodes;
 
+			std::atomic < generation_t > m_generation { 0 };
+
+			std::atomic < object_id_t > m_object_id { 0 }; // of the next object
+
+			subscriptions_container_t m_subscriptions;
+
+			std::atomic < std::size_t > m_subscriptions_size { 0 }; // read by writers without lock
+
+		private:
+
+			// changes are journaled as they are made, objects are written to the
+			// snapshot periodically by a thread of their own and once more on
+			// destruction, then the journal written before it is removed, writers
+			// are held only while ids are copied
+
+			static inline const std::chrono::seconds snapshot_period = std::chrono::seconds(60);
+
 		private:
 
 			mutable mutex_t m_objects_mutex;
 			mutable mutex_t m_lingual_mutex;
+
+			std::mutex m_subscriptions_mutex;
+
+		private:
+
+			Journal m_journal;
+
+		private:
+
+			std::mutex m_snapshot_mutex;
+
+			std::condition_variable m_snapshot_condition;
+
+			bool m_is_stopped = false;
+
+			std::thread m_snapshot_thread;
 		};
 
 	} // namespace system
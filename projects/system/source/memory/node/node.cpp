@@ -6,18 +6,33 @@ namespace solution
 	{
 		namespace memory
 		{
-			void Node::append(std::shared_ptr < Object > object)
+			void Node::append(object_id_t object_id, std::shared_ptr < Object > object)
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					auto result = m_objects.insert(object);
+					if (m_object_ids.empty() || m_object_ids.back() < object_id)
+					{
+						m_object_ids.push_back(object_id);
 
-					if (!result.second)
+						m_objects.push_back(object);
+					}
+					else
 					{
-						throw node_exception("already existed");
+						const auto position = gallop(object_id, 0U);
+
+						if (m_object_ids[position] == object_id)
+						{
+							throw node_exception("already existed");
+						}
+
+						m_object_ids.insert(std::next(std::begin(m_object_ids), position), object_id);
+
+						m_objects.insert(std::next(std::begin(m_objects), position), object);
 					}
+
+					update_bitmap(object_id, true);
 				}
 				catch (const std::exception & exception)
 				{
@@ -25,17 +40,21 @@ namespace solution
 				}
 			}
 
-			void Node::remove(std::shared_ptr < Object > object)
+			void Node::remove(object_id_t object_id)
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					auto iterator = m_objects.find(object);
+					const auto position = gallop(object_id, 0U);
 
-					if (iterator != std::end(m_objects))
+					if (position < std::size(m_object_ids) && m_object_ids[position] == object_id)
 					{
-						m_objects.erase(iterator);
+						m_object_ids.erase(std::next(std::begin(m_object_ids), position));
+
+						m_objects.erase(std::next(std::begin(m_objects), position));
+
+						update_bitmap(object_id, false);
 					}
 					else
 					{
@@ -48,6 +67,54 @@ namespace solution
 				}
 			}
 
+			void Node::update_bitmap(object_id_t object_id, bool is_marked)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto size = std::size(m_object_ids);
+
+					const auto last_id = (size == 0 ? 0U : static_cast < std::size_t > (m_object_ids.back()));
+
+					if (m_bitmap.empty())
+					{
+						if (size == 0 || size * dense_ratio < last_id)
+						{
+							return;
+						}
+
+						m_bitmap.assign(last_id / bits_per_word + 1U, 0U);
+
+						for (auto id : m_object_ids)
+						{
+							m_bitmap[id / bits_per_word] |= (std::uint64_t(1) << (id % bits_per_word));
+						}
+					}
+					else if (size * sparse_ratio < last_id)
+					{
+						bitmap_t().swap(m_bitmap);
+					}
+					else if (is_marked)
+					{
+						if (const auto index = object_id / bits_per_word; index >= std::size(m_bitmap))
+						{
+							m_bitmap.resize(index + 1U, 0U);
+						}
+
+						m_bitmap[object_id / bits_per_word] |= (std::uint64_t(1) << (object_id % bits_per_word));
+					}
+					else
+					{
+						m_bitmap[object_id / bits_per_word] &= ~(std::uint64_t(1) << (object_id % bits_per_word));
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < node_exception > (logger, exception);
+				}
+			}
+
 		} // namespace memory
 
 	} // namespace system
@@ -7,13 +7,17 @@
 #  pragma once
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <iterator>
 #include <memory>
 #include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
-#include <unordered_set>
+#include <vector>
 
 #include "../../../../shared/source/config/config.hpp"
 #include "../../../../shared/source/logger/logger.hpp"
@@ -40,17 +44,37 @@ namespace solution
 				~node_exception() noexcept = default;
 			};
 
+			// objects of a node are kept by increasing id in a compact array with
+			// a parallel array of objects, so intersections of nodes walk ids in
+			// order instead of hashing pointers, a dense node also keeps a bitmap
+			// of its ids, so membership in it is a single bit test
+
 			class Node
 			{
 			public:
 
 				using Object = shared::Object;
 
-				using objects_container_t = 
-					std::unordered_set < std::shared_ptr < Object > > ;
+				using object_id_t = std::uint32_t;
+
+				using object_ids_container_t = std::vector < object_id_t > ;
+
+				using objects_container_t = std::vector < std::shared_ptr < Object > > ; // by position of id
+
+				using bitmap_t = std::vector < std::uint64_t > ;
 
 				using mutex_t = std::shared_mutex;
 
+			private:
+
+				static constexpr std::size_t bits_per_word = 64U;
+
+				// bitmap is built when it is not larger than the array of ids and
+				// dropped when it becomes twice as large
+
+				static constexpr std::size_t dense_ratio  = 32U;
+				static constexpr std::size_t sparse_ratio = 64U;
+
 			public:
 
 				template < typename W, typename Enable =
@@ -67,6 +91,11 @@ namespace solution
 					return m_word;
 				}
 
+				const auto & object_ids() const noexcept
+				{
+					return m_object_ids;
+				}
+
 				const auto & objects() const noexcept
 				{
 					return m_objects;
@@ -79,9 +108,58 @@ namespace solution
 
 			public:
 
-				void append(std::shared_ptr < Object > object);
+				void append(object_id_t object_id, std::shared_ptr < Object > object);
+
+				void remove(object_id_t object_id);
+
+			public:
+
+				// position of the first id not less than object_id, searched by
+				// doubling steps from position first, so a walk through increasing
+				// ids costs the logarithm of each skip instead of the whole array
+
+				std::size_t gallop(object_id_t object_id, std::size_t first) const noexcept
+				{
+					const auto size = std::size(m_object_ids);
+
+					std::size_t step = 1U, last = first;
+
+					while (last < size && m_object_ids[last] < object_id)
+					{
+						first = last + 1U;
+
+						last += step;
+
+						step <<= 1U;
+					}
+
+					const auto begin = std::begin(m_object_ids);
+
+					return static_cast < std::size_t > (std::distance(begin, std::lower_bound(
+						begin + first, begin + std::min(last, size), object_id)));
+				}
+
+				// position is a hint for galloping, it is left at the first id not
+				// less than object_id when the node has no bitmap
+
+				bool contains(object_id_t object_id, std::size_t & position) const noexcept
+				{
+					if (!m_bitmap.empty())
+					{
+						const auto index = object_id / bits_per_word;
+
+						return (index < std::size(m_bitmap) && 
+							((m_bitmap[index] >> (object_id % bits_per_word)) & 1U));
+					}
 
-				void remove(std::shared_ptr < Object > object);
+					position = gallop(object_id, position);
+
+					return (position < std::size(m_object_ids) && m_object_ids[position] == object_id);
+				}
+
+			private:
+
+				void update_bitmap(object_id_t object_id, bool is_marked);
 
 			private:
 
@@ -89,8 +167,12 @@ namespace solution
 
 			private:
 
+				object_ids_container_t m_object_ids;
+
 				objects_container_t m_objects;
 
+				bitmap_t m_bitmap;
+
 			private:
 
 				mutable mutex_t m_objects_mutex;
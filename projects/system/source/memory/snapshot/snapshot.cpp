@@ -0,0 +1,288 @@
+#include "snapshot.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace memory
+		{
+			using Severity = shared::Logger::Severity;
+
+			void Snapshot::save(const path_t & path, const words_container_t & words, const entries_container_t & entries)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					Writer writer;
+
+					Header header;
+
+					header.words   = std::size(words);
+					header.objects = std::size(entries);
+
+					writer.write(header);
+
+					for (const auto & word : words)
+					{
+						writer.write(word);
+					}
+
+					for (const auto & entry : entries)
+					{
+						writer.write(static_cast < std::uint32_t > (std::size(entry.positions)));
+
+						writer.write(entry.positions.data(), std::size(entry.positions) * sizeof(position_t));
+
+						write(writer, entry.data);
+					}
+
+					auto & buffer = writer.buffer();
+
+					header.size = std::size(buffer);
+
+					std::memcpy(buffer.data(), &header, sizeof(header));
+
+					auto temporary_path = path; temporary_path += ".temp";
+
+					{
+						std::ofstream fout(temporary_path.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+						if (!fout)
+						{
+							throw snapshot_exception("cannot open file " + temporary_path.string());
+						}
+					}
+
+					boost::filesystem::resize_file(temporary_path, std::size(buffer));
+
+					{
+						boost::interprocess::file_mapping mapping(temporary_path.string().c_str(), boost::interprocess::read_write);
+
+						boost::interprocess::mapped_region region(mapping, boost::interprocess::read_write);
+
+						std::memcpy(region.get_address(), buffer.data(), std::size(buffer));
+
+						if (!region.flush(0, 0, false)) // synchronous, the rename must not overtake the data
+						{
+							throw snapshot_exception("cannot write file " + temporary_path.string());
+						}
+					}
+
+					boost::filesystem::rename(temporary_path, path);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < snapshot_exception > (logger, exception);
+				}
+			}
+
+			bool Snapshot::load(const path_t & path, words_container_t & words, entries_container_t & entries)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (!boost::filesystem::exists(path) || boost::filesystem::file_size(path) == 0)
+					{
+						return false;
+					}
+
+					try
+					{
+						parse(path, words, entries);
+
+						return true;
+					}
+					catch (const std::exception & exception)
+					{
+						logger.write(Severity::error, exception.what());
+					}
+
+					words.clear();
+
+					entries.clear();
+
+					auto invalid_path = path; invalid_path += ".invalid";
+
+					boost::filesystem::rename(path, invalid_path); // keeps the snapshot for inspection
+
+					logger.write(Severity::error, "file " + path.string() + " renamed to " + invalid_path.string());
+
+					return false;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < snapshot_exception > (logger, exception);
+				}
+			}
+
+			void Snapshot::parse(const path_t & path, words_container_t & words, entries_container_t & entries)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					boost::interprocess::file_mapping mapping(path.string().c_str(), boost::interprocess::read_only);
+
+					boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only);
+
+					const auto begin = static_cast < const char * > (region.get_address());
+
+					Reader reader(begin, begin + region.get_size());
+
+					Header header;
+
+					reader.read(header);
+
+					if (!is_valid(header) || header.size != region.get_size())
+					{
+						throw snapshot_exception("invalid snapshot " + path.string());
+					}
+
+					const auto word_size  = sizeof(std::uint32_t); // at least the length of a word
+					const auto entry_size = sizeof(std::uint32_t) + sizeof(std::uint8_t); // at least positions and kind
+
+					if (header.words > reader.remaining() / word_size || header.objects > reader.remaining() / entry_size ||
+						header.words * word_size + header.objects * entry_size > reader.remaining())
+					{
+						throw snapshot_exception("invalid counts in snapshot " + path.string());
+					}
+
+					words.resize(static_cast < std::size_t > (header.words));
+
+					for (auto & word : words)
+					{
+						reader.read(word);
+					}
+
+					entries.resize(static_cast < std::size_t > (header.objects));
+
+					for (auto & entry : entries)
+					{
+						std::uint32_t size = 0;
+
+						reader.read(size);
+
+						reader.require(size * sizeof(position_t));
+
+						entry.positions.resize(size);
+
+						reader.read(entry.positions.data(), size * sizeof(position_t));
+
+						if (std::any_of(std::begin(entry.positions), std::end(entry.positions),
+							[&words](auto position) { return (position >= std::size(words)); }))
+						{
+							throw snapshot_exception("invalid word position in snapshot " + path.string());
+						}
+
+						read(reader, entry.data);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < snapshot_exception > (logger, exception);
+				}
+			}
+
+			void Snapshot::write(Writer & writer, const data_t & data)
+			{
+				writer.write(static_cast < std::uint8_t > (data.index()));
+
+				std::visit([&writer](const auto & value)
+				{
+					using value_t = std::decay_t < decltype(value) > ;
+
+					if constexpr (std::is_same_v < value_t, std::string > )
+					{
+						writer.write(value);
+					}
+					else if constexpr (std::is_same_v < value_t, shared::Object::vector_t > )
+					{
+						writer.write(static_cast < std::uint32_t > (std::size(value)));
+
+						writer.write(value.data(), std::size(value) * sizeof(double));
+					}
+					else
+					{
+						writer.write(value);
+					}
+				}, data);
+			}
+
+			void Snapshot::read(Reader & reader, data_t & data)
+			{
+				std::uint8_t index = 0;
+
+				reader.read(index);
+
+				switch (index)
+				{
+				case 0:
+				{
+					double value = 0.0;
+
+					reader.read(value);
+
+					data.emplace < double > (value);
+
+					break;
+				}
+				case 1:
+				{
+					std::int64_t value = 0;
+
+					reader.read(value);
+
+					data.emplace < std::int64_t > (value);
+
+					break;
+				}
+				case 2:
+				{
+					std::uint64_t value = 0;
+
+					reader.read(value);
+
+					data.emplace < std::uint64_t > (value);
+
+					break;
+				}
+				case 3:
+				{
+					std::string value;
+
+					reader.read(value);
+
+					data.emplace < std::string > (std::move(value));
+
+					break;
+				}
+				case 4:
+				{
+					std::uint32_t size = 0;
+
+					reader.read(size);
+
+					reader.require(size * sizeof(double));
+
+					shared::Object::vector_t value(size);
+
+					reader.read(value.data(), size * sizeof(double));
+
+					data.emplace < shared::Object::vector_t > (std::move(value));
+
+					break;
+				}
+				default:
+				{
+					throw snapshot_exception("unknown kind of value " + std::to_string(index));
+				}
+				}
+			}
+
+		} // namespace memory
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,252 @@
+#ifndef SOLUTION_SYSTEM_MEMORY_SNAPSHOT_HPP
+#define SOLUTION_SYSTEM_MEMORY_SNAPSHOT_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "../../../../shared/source/config/config.hpp"
+#include "../../../../shared/source/logger/logger.hpp"
+#include "../../../../shared/source/object/object.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace memory
+		{
+			class snapshot_exception : public std::exception
+			{
+			public:
+
+				explicit snapshot_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit snapshot_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~snapshot_exception() noexcept = default;
+			};
+
+			// binary image of memory: a header, the words of nodes, then objects
+			// as positions of their words and a tagged value, written in native
+			// byte order by the same platform to a temporary file synced to disk
+			// and renamed over the previous one, so a reader never sees a partial
+			// snapshot, an invalid snapshot is moved aside and memory starts empty
+
+			class Snapshot
+			{
+			public:
+
+				using words_container_t = shared::Config::words_container_t;
+
+				using position_t = std::uint32_t; // of a word in the snapshot
+
+				using positions_container_t = std::vector < position_t > ;
+
+				using data_t = shared::Object::data_t;
+
+				static_assert(std::variant_size_v < data_t > == 5U, "Snapshot does not cover all kinds of data_t");
+
+				using path_t = boost::filesystem::path;
+
+			public:
+
+				struct Header
+				{
+					char magic[4] = { 'M', 'E', 'M', 'O' };
+
+					std::uint32_t version = 1U;
+
+					std::uint64_t words = 0;
+
+					std::uint64_t objects = 0;
+
+					std::uint64_t size = 0; // of the whole file
+				};
+
+				static_assert(std::is_trivially_copyable_v < Header > , "Header is not trivially copyable");
+
+			public:
+
+				struct Entry
+				{
+					positions_container_t positions;
+
+					data_t data;
+				};
+
+				using entries_container_t = std::vector < Entry > ;
+
+			public:
+
+				static bool is_valid(const Header & header) noexcept
+				{
+					const Header expected;
+
+					return (std::equal(std::begin(header.magic), std::end(header.magic), std::begin(expected.magic)) &&
+						header.version == expected.version);
+				}
+
+			public:
+
+				static void save(const path_t & path, const words_container_t & words, const entries_container_t & entries);
+
+				static bool load(const path_t & path, words_container_t & words, entries_container_t & entries); // false if absent or invalid
+
+			private:
+
+				static void parse(const path_t & path, words_container_t & words, entries_container_t & entries);
+
+			public:
+
+				// encoding of values shared with the journal of memory
+
+				class Writer
+				{
+				public:
+
+					void write(const void * data, std::size_t size)
+					{
+						m_buffer.append(static_cast < const char * > (data), size);
+					}
+
+					template < typename T >
+					void write(const T & value)
+					{
+						static_assert(std::is_trivially_copyable_v < T > , "T is not trivially copyable");
+
+						write(&value, sizeof(value));
+					}
+
+					void write(const std::string & string)
+					{
+						write(static_cast < std::uint32_t > (std::size(string)));
+
+						write(string.data(), std::size(string));
+					}
+
+				public:
+
+					auto & buffer() noexcept
+					{
+						return m_buffer;
+					}
+
+					auto size() const noexcept
+					{
+						return std::size(m_buffer);
+					}
+
+				private:
+
+					std::string m_buffer;
+				};
+
+				// bounds are checked on every read, values are copied out, since
+				// positions in the mapped file are not aligned
+
+				class Reader
+				{
+				public:
+
+					explicit Reader(const char * begin, const char * end) noexcept : m_current(begin), m_end(end)
+					{}
+
+				public:
+
+					void read(void * data, std::size_t size)
+					{
+						if (static_cast < std::size_t > (m_end - m_current) < size)
+						{
+							throw snapshot_exception("unexpected end of snapshot");
+						}
+
+						std::memcpy(data, m_current, size);
+
+						m_current += size;
+					}
+
+					template < typename T >
+					void read(T & value)
+					{
+						static_assert(std::is_trivially_copyable_v < T > , "T is not trivially copyable");
+
+						read(&value, sizeof(value));
+					}
+
+					void read(std::string & string)
+					{
+						std::uint32_t size = 0;
+
+						read(size);
+
+						require(size);
+
+						string.resize(size);
+
+						read(string.data(), size);
+					}
+
+					void require(std::size_t size) const // before allocating for a size read from the file
+					{
+						if (static_cast < std::size_t > (m_end - m_current) < size)
+						{
+							throw snapshot_exception("unexpected end of snapshot");
+						}
+					}
+
+				public:
+
+					bool is_empty() const noexcept
+					{
+						return (m_current == m_end);
+					}
+
+					auto remaining() const noexcept
+					{
+						return static_cast < std::size_t > (m_end - m_current);
+					}
+
+				private:
+
+					const char * m_current;
+
+					const char * const m_end;
+				};
+
+			public:
+
+				static void write(Writer & writer, const data_t & data);
+
+				static void read (Reader & reader,       data_t & data);
+			};
+
+		} // namespace memory
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MEMORY_SNAPSHOT_HPP
\ No newline at end of file
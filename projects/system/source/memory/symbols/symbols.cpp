@@ -0,0 +1,91 @@
+#include "symbols.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace memory
+		{
+			Symbols::id_t Symbols::intern(const std::string & word)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (auto id = find(word); id != invalid_id)
+					{
+						return id;
+					}
+
+					std::scoped_lock < mutex_t > lock(m_mutex);
+
+					if (auto iterator = m_ids.find(word); iterator != std::end(m_ids))
+					{
+						return iterator->second;
+					}
+
+					if (m_words.size() >= static_cast < std::size_t > (invalid_id))
+					{
+						throw symbols_exception("too many symbols");
+					}
+
+					const auto id = static_cast < id_t > (m_words.size());
+
+					m_words.push_back(word);
+
+					m_ids.emplace(word, id);
+
+					return id;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < symbols_exception > (logger, exception);
+				}
+			}
+
+			Symbols::id_t Symbols::find(const std::string & word) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::shared_lock < mutex_t > lock(m_mutex);
+
+					auto iterator = m_ids.find(word);
+
+					return (iterator == std::end(m_ids) ? invalid_id : iterator->second);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < symbols_exception > (logger, exception);
+				}
+			}
+
+			std::string Symbols::word(id_t id) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::shared_lock < mutex_t > lock(m_mutex);
+
+					return m_words.at(id);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < symbols_exception > (logger, exception);
+				}
+			}
+
+			std::size_t Symbols::size() const
+			{
+				std::shared_lock < mutex_t > lock(m_mutex);
+
+				return m_words.size();
+			}
+
+		} // namespace memory
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
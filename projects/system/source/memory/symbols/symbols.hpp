@@ -0,0 +1,104 @@
+#ifndef SOLUTION_SYSTEM_MEMORY_SYMBOLS_HPP
+#define SOLUTION_SYSTEM_MEMORY_SYMBOLS_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../../../shared/source/config/config.hpp"
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace memory
+		{
+			class symbols_exception : public std::exception
+			{
+			public:
+
+				explicit symbols_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit symbols_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~symbols_exception() noexcept = default;
+			};
+
+			// table of interned words, ids are dense and never reused, so they
+			// index nodes directly and order locks the same way for every view
+
+			class Symbols
+			{
+			public:
+
+				using id_t = shared::Config::id_t;
+
+				using ids_container_t = shared::Config::ids_container_t;
+
+				using words_container_t = shared::Config::words_container_t;
+
+			private:
+
+				using ids_map_t = std::unordered_map < std::string, id_t > ;
+
+				using mutex_t = std::shared_mutex;
+
+			public:
+
+				static constexpr id_t invalid_id = std::numeric_limits < id_t > ::max();
+
+			public:
+
+				Symbols() = default;
+
+				~Symbols() noexcept = default;
+
+			private:
+
+				Symbols			  (const Symbols &) = delete;
+				Symbols & operator=(const Symbols &) = delete;
+
+			public:
+
+				id_t intern(const std::string & word);
+
+				id_t find(const std::string & word) const;
+
+				std::string word(id_t id) const;
+
+				std::size_t size() const;
+
+			private:
+
+				ids_map_t m_ids;
+
+				words_container_t m_words;
+
+			private:
+
+				mutable mutex_t m_mutex;
+			};
+
+		} // namespace memory
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MEMORY_SYMBOLS_HPP
\ No newline at end of file
@@ -0,0 +1,131 @@
+#ifndef SOLUTION_SYSTEM_MEMORY_DIRECT_VIEW_HPP
+#define SOLUTION_SYSTEM_MEMORY_DIRECT_VIEW_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "../memory.hpp"
+
+#include "../../../../shared/source/memory/view/static_view.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace memory
+		{
+			// view for code of the system module itself, hooks are resolved at
+			// compile time and forward straight to memory, View wraps it for actions
+
+			class Direct_View : public shared::memory::Static_View < Direct_View >
+			{
+			private:
+
+				static_assert(std::is_convertible_v < words_container_t, Memory::words_container_t >,
+					"Direct_View::words_container_t is not convertible to Memory::words_container_t");
+
+				static_assert(std::is_convertible_v < ids_container_t, Memory::ids_container_t >,
+					"Direct_View::ids_container_t is not convertible to Memory::ids_container_t");
+
+				static_assert(std::is_same_v < Memory::generation_t, generation_t >,
+					"Memory::generation_t is not the same as Direct_View::generation_t");
+
+			public:
+
+				explicit Direct_View(std::shared_ptr < Memory > memory) noexcept : m_memory(memory)
+				{}
+
+				~Direct_View() noexcept = default;
+
+			private:
+
+				friend class shared::memory::Static_View < Direct_View > ;
+
+				friend class View;
+
+			private:
+
+				void intern_implementation(const words_container_t & words, ids_container_t & ids) const
+				{
+					m_memory->intern_implementation(words, ids);
+				}
+
+				void acquire_implementation(Mode mode, const ids_union_t & ids) const
+				{
+					m_memory->acquire_implementation(mode == Mode::unique, ids);
+				}
+
+				void release_implementation(Mode mode, const ids_union_t & ids) const
+				{
+					m_memory->release_implementation(mode == Mode::unique, ids);
+				}
+
+				void get_implementation(const ids_container_t & ids, data_t & data) const
+				{
+					m_memory->get_implementation(ids, data);
+				}
+
+				void set_implementation(const ids_container_t & ids, const data_t & data) const
+				{
+					m_memory->set_implementation(ids, data);
+				}
+
+				void resolve_implementation(const ids_union_t & ids, const data_t * data, std::shared_ptr < Object > & object) const
+				{
+					m_memory->resolve_implementation(ids, data, object);
+				}
+
+				generation_t generation_implementation() const noexcept
+				{
+					return m_memory->generation_implementation();
+				}
+
+				void load_implementation(const Object & object, data_t & data) const
+				{
+					data = object.data();
+				}
+
+				void store_implementation(const ids_union_t & ids, Object & object, const data_t & data) const
+				{
+					m_memory->store_implementation(ids, object, data);
+				}
+
+				void subscribe_implementation(const ids_union_t & ids, std::shared_ptr < Subscription > & subscription) const
+				{
+					m_memory->subscribe_implementation(ids, subscription);
+				}
+
+				void history_implementation(Object & object, std::size_t capacity) const
+				{
+					object.set_history(capacity);
+				}
+
+				void load_range_implementation(const Object & object, timestamp_t begin, timestamp_t end, samples_container_t & samples) const
+				{
+					object.get_range(begin, end, samples);
+				}
+
+				void load_last_implementation(const Object & object, std::size_t size, samples_container_t & samples) const
+				{
+					object.get_last(size, samples);
+				}
+
+			private:
+
+				std::shared_ptr < Memory > m_memory;
+			};
+
+		} // namespace memory
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MEMORY_DIRECT_VIEW_HPP
\ No newline at end of file
@@ -6,33 +6,13 @@ namespace solution
 	{
 		namespace memory
 		{
-			void View::acquire_implementation(Mode mode, const words_union_t & words) const
+			void View::intern_implementation(const words_container_t & words, ids_container_t & ids) const
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					switch (mode)
-					{
-					case Mode::shared:
-					{
-						for (const auto & word : words)
-						{
-							m_memory->m_nodes.at(word)->objects_mutex().lock_shared();
-						}
-
-						break;
-					}
-					case Mode::unique:
-					{
-						for (const auto & word : words)
-						{
-							m_memory->m_nodes.at(word)->objects_mutex().lock();
-						}
-
-						break;
-					}
-					}
+					m_view.intern_implementation(words, ids);
 				}
 				catch (const std::exception & exception)
 				{
@@ -40,33 +20,13 @@ namespace solution
 				}
 			}
 
-			void View::release_implementation(Mode mode, const words_union_t & words) const
+			void View::acquire_implementation(Mode mode, const ids_union_t & ids) const
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					switch (mode)
-					{
-					case Mode::shared:
-					{
-						for (const auto & word : words)
-						{
-							m_memory->m_nodes.at(word)->objects_mutex().unlock_shared();
-						}
-
-						break;
-					}
-					case Mode::unique:
-					{
-						for (const auto & word : words)
-						{
-							m_memory->m_nodes.at(word)->objects_mutex().unlock();
-						}
-
-						break;
-					}
-					}
+					m_view.acquire_implementation(make_mode(mode), ids);
 				}
 				catch (const std::exception & exception)
 				{
@@ -74,13 +34,13 @@ namespace solution
 				}
 			}
 
-			void View::get_implementation(const words_container_t & words, data_t & data) const
+			void View::release_implementation(Mode mode, const ids_union_t & ids) const
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					m_memory->get_implementation(words, data);
+					m_view.release_implementation(make_mode(mode), ids);
 				}
 				catch (const std::exception & exception)
 				{
@@ -88,13 +48,139 @@ namespace solution
 				}
 			}
 
-			void View::set_implementation(const words_container_t & words, const data_t & data) const
+			void View::get_implementation(const ids_container_t & ids, data_t & data) const
 			{
 				RUN_LOGGER(logger);
 
 				try
 				{
-					m_memory->set_implementation(words, data);
+					m_view.get_implementation(ids, data);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < view_exception > (logger, exception);
+				}
+			}
+
+			void View::set_implementation(const ids_container_t & ids, const data_t & data) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_view.set_implementation(ids, data);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < view_exception > (logger, exception);
+				}
+			}
+
+			void View::resolve_implementation(const ids_union_t & ids, const data_t * data, std::shared_ptr < Object > & object) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_view.resolve_implementation(ids, data, object);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < view_exception > (logger, exception);
+				}
+			}
+
+			View::generation_t View::generation_implementation() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return m_view.generation_implementation();
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < view_exception > (logger, exception);
+				}
+			}
+
+			void View::load_implementation(const Object & object, data_t & data) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_view.load_implementation(object, data);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < view_exception > (logger, exception);
+				}
+			}
+
+			void View::store_implementation(const ids_union_t & ids, Object & object, const data_t & data) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_view.store_implementation(ids, object, data);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < view_exception > (logger, exception);
+				}
+			}
+
+			void View::subscribe_implementation(const ids_union_t & ids, std::shared_ptr < Subscription > & subscription) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_view.subscribe_implementation(ids, subscription);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < view_exception > (logger, exception);
+				}
+			}
+
+			void View::history_implementation(Object & object, std::size_t capacity) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_view.history_implementation(object, capacity);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < view_exception > (logger, exception);
+				}
+			}
+
+			void View::load_range_implementation(const Object & object, timestamp_t begin, timestamp_t end, samples_container_t & samples) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_view.load_range_implementation(object, begin, end, samples);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < view_exception > (logger, exception);
+				}
+			}
+
+			void View::load_last_implementation(const Object & object, std::size_t size, samples_container_t & samples) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_view.load_last_implementation(object, size, samples);
 				}
 				catch (const std::exception & exception)
 				{
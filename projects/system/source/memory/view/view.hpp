@@ -8,11 +8,14 @@
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
 #include <exception>
+#include <cstddef>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 
+#include "direct_view.hpp"
+
 #include "../memory.hpp"
 
 #include "../../../../shared/source/logger/logger.hpp"
@@ -41,6 +44,9 @@ namespace solution
 				~view_exception() noexcept = default;
 			};
 
+			// virtual adapter passed to actions across the module boundary, every
+			// hook forwards to the inlined hook of Direct_View
+
 			class View : public shared::memory::View_Base
 			{
 			private:
@@ -48,29 +54,60 @@ namespace solution
 				static_assert(std::is_convertible_v < words_container_t, Memory::words_container_t >,
 					"View::words_container_t is not convertible to Memory::words_container_t");
 
+				static_assert(std::is_convertible_v < ids_container_t, Memory::ids_container_t >,
+					"View::ids_container_t is not convertible to Memory::ids_container_t");
+
+				static_assert(std::is_same_v < Memory::generation_t, generation_t >,
+					"Memory::generation_t is not the same as View::generation_t");
+
 				static_assert(std::is_convertible_v < Memory::data_t, data_t >,
 					"Memory::data_t is not convertible to View::data_t");
 
 			public:
 
-				explicit View(std::shared_ptr < Memory > memory) noexcept : m_memory(memory)
+				explicit View(std::shared_ptr < Memory > memory) noexcept : m_view(memory)
 				{}
 
 				~View() noexcept = default;
 
 			private:
 
-				virtual void acquire_implementation(Mode mode, const words_union_t & words) const override;
+				virtual void intern_implementation(const words_container_t & words, ids_container_t & ids) const override;
+
+				virtual void acquire_implementation(Mode mode, const ids_union_t & ids) const override;
+
+				virtual void release_implementation(Mode mode, const ids_union_t & ids) const override;
+
+				virtual void get_implementation(const ids_container_t & ids,       data_t & data) const override;
+
+				virtual void set_implementation(const ids_container_t & ids, const data_t & data) const override;
 
-				virtual void release_implementation(Mode mode, const words_union_t & words) const override;
+				virtual void resolve_implementation(const ids_union_t & ids, const data_t * data, std::shared_ptr < Object > & object) const override;
 
-				virtual void get_implementation(const words_container_t & words,       data_t & data) const override;
+				virtual generation_t generation_implementation() const override;
+
+				virtual void load_implementation(const Object & object, data_t & data) const override;
+
+				virtual void store_implementation(const ids_union_t & ids, Object & object, const data_t & data) const override;
+
+				virtual void subscribe_implementation(const ids_union_t & ids, std::shared_ptr < Subscription > & subscription) const override;
+
+				virtual void history_implementation(Object & object, std::size_t capacity) const override;
+
+				virtual void load_range_implementation(const Object & object, timestamp_t begin, timestamp_t end, samples_container_t & samples) const override;
+
+				virtual void load_last_implementation(const Object & object, std::size_t size, samples_container_t & samples) const override;
+
+			private:
 
-				virtual void set_implementation(const words_container_t & words, const data_t & data) const override;
+				static Direct_View::Mode make_mode(Mode mode) noexcept
+				{
+					return (mode == Mode::unique ? Direct_View::Mode::unique : Direct_View::Mode::shared);
+				}
 
 			private:
 
-				std::shared_ptr < Memory > m_memory;
+				Direct_View m_view;
 			};
 
 		} // namespace memory
@@ -61,30 +61,52 @@ namespace solution
 			}
 		}
 		
-		double Market::get_current_price(const std::string & asset) const
+		Market::price_t Market::get_current_price(const std::string & asset) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				using shared_memory_t = boost::interprocess::managed_shared_memory;
+				m_segment.update();
 
-				using price_t = double;
+				return m_segment.candles(asset, default_scale).price();
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		Market::scale_t Market::get_price_scale(const std::string & asset) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::string reason;
+
+				try
+				{
+					m_segment.update();
 
-				using mutex_t = boost::interprocess::interprocess_mutex;
+					return m_segment.candles(asset, default_scale).scale();
+				}
+				catch (const std::exception & exception)
+				{
+					reason = exception.what();
+				}
 
-				const std::string default_scale = "H1";
+				std::scoped_lock lock(m_price_scales_mutex);
 
-				const auto shared_memory_name = "QUIK_" + asset + "_" + default_scale;
+				if (auto iterator = m_price_scales.find(asset); iterator != std::end(m_price_scales))
+				{
+					return iterator->second;
+				}
 
-				shared_memory_t shared_memory(boost::interprocess::open_only, shared_memory_name.c_str());
+				logger.write(Severity::error, "no " + default_scale + " candles of " + asset +
+					" in plugin segment, price scale is taken from finam data: " + reason); // once per asset
 
-				auto price = shared_memory.find < price_t > (boost::interprocess::unique_instance).first;
-				auto mutex = shared_memory.find < mutex_t > (boost::interprocess::unique_instance).first;
-			
-				boost::interprocess::scoped_lock < mutex_t > lock(*mutex);
-				
-				return *price;
+				return m_price_scales.emplace(asset, make_price_scale(asset)).first->second;
 			}
 			catch (const std::exception & exception)
 			{
@@ -112,6 +134,71 @@ namespace solution
 			}
 		}
 
+		Market::scale_t Market::make_price_scale(const std::string & asset) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				static const auto separator = ',';
+
+				auto is_found = false;
+
+				scale_t scale = 0;
+
+				if (std::filesystem::exists(directory))
+				{
+					for (const auto & entry : std::filesystem::directory_iterator(directory))
+					{
+						const auto name = entry.path().filename().string();
+
+						if (entry.path().extension() != Extension::txt || name.rfind(asset + "_", 0) != 0)
+						{
+							continue;
+						}
+
+						std::fstream fin(entry.path().string(), std::ios::in);
+
+						for (std::string line; std::getline(fin, line); )
+						{
+							std::string_view view(line);
+
+							for (auto field = 0U; field < 6U; ++field) // date, time, open, high, low, close
+							{
+								const auto position = view.find(separator);
+
+								if (field >= 2U)
+								{
+									scale = std::max(scale, Price::decimals(view.substr(0, position)));
+
+									is_found = true;
+								}
+
+								if (position == std::string_view::npos)
+								{
+									break;
+								}
+
+								view.remove_prefix(position + 1);
+							}
+						}
+					}
+				}
+
+				if (!is_found || scale > Price::max_scale)
+				{
+					throw market_exception("price scale of " + asset + " unknown: no " + default_scale +
+						" candles in plugin segment and no finam data in " + directory.string());
+				}
+
+				return scale;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
 	} // namespace trader
 
 } // namespace solution
\ No newline at end of file
@@ -7,6 +7,7 @@
 #  pragma once
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <ctime>
@@ -14,23 +15,23 @@
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <sstream>
+#include <string_view>
+#include <unordered_map>
 
 #define BOOST_PYTHON_STATIC_LIB
 
-#include <boost/interprocess/allocators/allocator.hpp>
-#include <boost/interprocess/containers/deque.hpp>
-#include <boost/interprocess/containers/string.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
-#include <boost/interprocess/sync/interprocess_mutex.hpp>
-#include <boost/interprocess/sync/named_mutex.hpp>
-#include <boost/interprocess/sync/scoped_lock.hpp>
 #include <boost/interprocess/managed_windows_shared_memory.hpp>
 #include <boost/python.hpp>
 
 #include "../../../shared/source/logger/logger.hpp"
+#include "../../../shared/source/market/candles/candles.hpp"
+#include "../../../shared/source/market/price/price.hpp"
+#include "../../../shared/source/market/segment/segment.hpp"
 #include "../../../shared/source/python/python.hpp"
 
 namespace solution
@@ -58,6 +59,12 @@ namespace solution
 
 			using clock_t = std::chrono::system_clock;
 
+			using Price = shared::market::Price;
+
+			using price_t = Price::ticks_t;
+
+			using scale_t = Price::scale_t;
+
 		private:
 
 			using time_point_t = std::chrono::time_point < clock_t > ;
@@ -66,6 +73,10 @@ namespace solution
 
 			using Severity = shared::Logger::Severity;
 
+			using Candles = shared::market::Candles;
+
+			using Segment = shared::market::Segment;
+
 		private:
 
 			struct Extension
@@ -97,15 +108,35 @@ namespace solution
 			std::filesystem::path get(
 				const std::string & asset, const std::string & scale, time_point_t first, time_point_t last) const;
 			
-			double get_current_price(const std::string & asset) const;
+			price_t get_current_price(const std::string & asset) const;
+
+			// scale of the plugin segment, or when its candles are not available
+			// the largest number of decimals in finam data of the asset loaded
+			// by get, throws when neither is available
+
+			scale_t get_price_scale(const std::string & asset) const;
 			
 		private:
 
 			date_t make_date(time_point_t time_point) const;
+
+			scale_t make_price_scale(const std::string & asset) const;
 			
 		private:
 
 			static inline const std::filesystem::path directory = "market/data";
+
+			static inline const std::string default_scale = "H1";
+
+		private:
+
+			mutable Segment m_segment;
+
+		private:
+
+			mutable std::unordered_map < std::string, scale_t > m_price_scales; // from finam data, by asset
+
+			mutable std::mutex m_price_scales_mutex;
 		};
 
 	} // namespace trader
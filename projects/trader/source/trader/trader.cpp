@@ -98,12 +98,16 @@ namespace solution
 						{
 							std::packaged_task < void() > task([this, asset, scale, first, last]() 
 							{
-								auto points = make_points(m_market.get(asset, scale, first, last));
+								const auto path = m_market.get(asset, scale, first, last);
+
+								const auto price_scale = m_market.get_price_scale(asset); // may need the data just loaded
+
+								auto points = make_points(path, price_scale);
 
 								auto week_levels = 
-									reduce_levels(make_levels(points, Level_Resolution::week));
+									reduce_levels(make_levels(points, price_scale, Level_Resolution::week));
 								auto month_levels = 
-									reduce_levels(make_levels(points, Level_Resolution::month));
+									reduce_levels(make_levels(points, price_scale, Level_Resolution::month));
 
 								{
 									std::scoped_lock lock(m_levels_mutex);
@@ -171,7 +175,7 @@ namespace solution
 					{
 						for (auto current = std::next(first); current != levels.end();)
 						{
-							if (std::abs(first->price - current->price) / first->price <= price_deviation)
+							if (std::abs(first->price - current->price) <= price_deviation * first->price)
 							{
 								++first->strength;
 
@@ -193,8 +197,8 @@ namespace solution
 			}
 		}
 
-		std::vector < Trader::Level > Trader::make_levels(
-			const std::vector < Point > & points, Level_Resolution level_resolution) const
+		std::vector < Trader::Level > Trader::make_levels(const std::vector < Point > & points,
+			scale_t scale, Level_Resolution level_resolution) const
 		{
 			RUN_LOGGER(logger);
 
@@ -238,7 +242,7 @@ namespace solution
 						last->price > extremum.first->price) ||
 						(extremum.first != first && extremum.first != std::prev(last)))
 					{
-						levels.push_back(Level{ extremum.first->time, extremum.first->price, 0U });
+						levels.push_back(Level{ extremum.first->time, extremum.first->price, scale, 0U });
 					}
 
 					if ((extremum.second == first && first != points.begin() &&
@@ -247,7 +251,7 @@ namespace solution
 						last->price > extremum.second->price) ||
 						(extremum.second != first && extremum.second != std::prev(last)))
 					{
-						levels.push_back(Level{ extremum.second->time, extremum.second->price, 0U });
+						levels.push_back(Level{ extremum.second->time, extremum.second->price, scale, 0U });
 					}
 
 					first = last;
@@ -262,7 +266,7 @@ namespace solution
 		}
 
 		std::vector < Trader::Point > Trader::make_points(
-			const std::filesystem::path & path) const
+			const std::filesystem::path & path, scale_t scale) const
 		{
 			RUN_LOGGER(logger);
 
@@ -283,7 +287,7 @@ namespace solution
 
 				while (std::getline(fin, line))
 				{
-					plot.push_back(parse(line));
+					plot.push_back(parse(line, scale));
 				}
 
 				plot.shrink_to_fit();
@@ -296,30 +300,53 @@ namespace solution
 			}
 		}
 
-		Trader::Point Trader::parse(const std::string & line) const
+		Trader::Point Trader::parse(const std::string & line, scale_t scale) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				Candle_Parser < std::string::const_iterator > parser;
+				static const auto separator = ',';
 
-				auto first = std::begin(line);
-				auto last  = std::end  (line);
+				std::vector < std::string_view > fields;
 
-				Candle candle;
+				for (std::string_view view(line); ; )
+				{
+					const auto position = view.find(separator);
+
+					fields.push_back(view.substr(0, position));
 
-				auto result = boost::spirit::qi::phrase_parse(
-					first, last, parser, boost::spirit::qi::blank, candle);
+					if (position == std::string_view::npos)
+					{
+						break;
+					}
 
-				if (result)
+					view.remove_prefix(position + 1);
+				}
+
+				if (fields.size() != 7U)
 				{
-					return Point { parse(candle.date, candle.time), candle.price_close };
+					throw trader_exception("cannot parse line " + line);
 				}
-				else
+
+				Candle candle;
+
+				candle.date = fields[0];
+				candle.time = fields[1];
+
+				candle.price_open  = Price::parse(fields[2], scale);
+				candle.price_high  = Price::parse(fields[3], scale);
+				candle.price_low   = Price::parse(fields[4], scale);
+				candle.price_close = Price::parse(fields[5], scale);
+
+				const auto volume = fields[6];
+
+				if (std::from_chars(volume.data(), volume.data() + volume.size(), candle.volume).ec != std::errc())
 				{
 					throw trader_exception("cannot parse line " + line);
 				}
+
+				return Point { parse(candle.date, candle.time), candle.price_close };
 			}
 			catch (const std::exception & exception)
 			{
@@ -494,7 +521,7 @@ namespace solution
 
 				stream << 
 					"price: " << std::setw(8) << std::setfill(' ') << std::right << 
-						std::setprecision(2) << std::fixed << level.price << " " <<
+						Trader::Price::to_string(level.price, level.scale) << " " <<
 					"since: " << std::put_time(&tm, "%y.%m.%d") << " "
 					"alive: " << std::setw(3) << std::setfill(' ') << std::right <<
 						duration_since_time_point < days, Trader::clock_t > (level.time).count() << " " <<
@@ -617,16 +644,20 @@ namespace solution
 					{
 						const auto price = m_market.get_current_price(asset.first);
 
+						const auto scale = m_market.get_price_scale(asset.first);
+
+						const auto value = Price::to_double(price, scale);
+
 						std::ostringstream sout_level;
 						std::ostringstream sout_state;
 
 						sout_state << std::setprecision(2) << std::fixed << "[" << asset.first << "]" << 
 							" price: " << std::setw(8) << std::setfill(' ') << std::right << 
-								price <<
+								value <<
 							" delta: " << std::setw(6) << std::setfill(' ') << std::right <<
-								price / 100.0 * 1.0 * 0.25 <<
+								value / 100.0 * 1.0 * 0.25 <<
 							" limit: " << std::setw(6) << std::setfill(' ') << std::right <<
-								price / 100.0 * 1.0 << '\n';
+								value / 100.0 * 1.0 << '\n';
 
 						stream_states << sout_state.str();
 
@@ -636,7 +667,9 @@ namespace solution
 						{
 							for (const auto & level : level_resolution.second)
 							{
-								if (std::abs(level.price - price) / price <= price_deviation)
+								const auto level_price = Price::rescale(level.price, level.scale, scale); // levels may be loaded at finam scale
+
+								if (std::abs(level_price - price) <= price_deviation * price)
 								{
 									sout_level << "[" << asset.first << "] " << level << '\n';
 
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <charconv>
 #include <chrono>
 #include <cmath>
 #include <ctime>
@@ -30,20 +31,14 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <boost/asio.hpp>
-#include <boost/config/warning_disable.hpp>
 #include <boost/extended/application/service.hpp>
-#include <boost/fusion/include/adapt_struct.hpp>
-#include <boost/fusion/include/io.hpp>
-#include <boost/spirit/include/qi.hpp>
-#include <boost/spirit/include/phoenix_core.hpp>
-#include <boost/spirit/include/phoenix_operator.hpp>
-#include <boost/spirit/include/phoenix_object.hpp>
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
@@ -85,12 +80,18 @@ namespace solution
 
 			using time_point_t = clock_t::time_point;
 
+			using Price = Market::Price;
+
+			using price_t = Market::price_t;
+
+			using scale_t = Market::scale_t;
+
 		private:
 
 			struct Point
 			{
 				time_point_t time;
-				double price;
+				price_t price;
 			};
 
 		public:
@@ -107,7 +108,8 @@ namespace solution
 			struct Level
 			{
 				time_point_t time;
-				double price;
+				price_t price;
+				scale_t scale;
 				std::size_t strength;
 			};
 
@@ -141,7 +143,7 @@ namespace solution
 				using date_t = std::string;
 				using time_t = std::string;
 
-				using price_t = double;
+				using price_t = Trader::price_t;
 
 				using volume_t = std::uint64_t;
 
@@ -156,39 +158,6 @@ namespace solution
 				volume_t volume;
 			};
 
-		private:
-
-			template < typename Iterator >
-			class Candle_Parser :
-				public boost::spirit::qi::grammar < Iterator, Candle(), boost::spirit::qi::blank_type >
-			{
-			private:
-
-				using rule_t = boost::spirit::qi::rule < Iterator, Candle(), boost::spirit::qi::blank_type > ;
-
-			public:
-
-				Candle_Parser() : Candle_Parser::base_type(start)
-				{
-					static const auto separator = ',';
-
-					start %=
-						+(boost::spirit::qi::char_ - separator) >> separator >>
-						+(boost::spirit::qi::char_ - separator) >> separator >>
-						  boost::spirit::qi::double_			>> separator >>
-						  boost::spirit::qi::double_			>> separator >>
-						  boost::spirit::qi::double_			>> separator >>
-						  boost::spirit::qi::double_			>> separator >>
-						  boost::spirit::qi::ulong_long;
-				}
-
-				~Candle_Parser() noexcept = default;
-
-			private:
-
-				rule_t start;
-			};
-
 		private:
 
 			struct Extension
@@ -258,12 +227,12 @@ namespace solution
 
 			std::vector < Level > reduce_levels(std::vector < Level > && levels) const;
 
-			std::vector < Level > make_levels(
-				const std::vector < Point > & points, Level_Resolution level_resolution) const;
+			std::vector < Level > make_levels(const std::vector < Point > & points,
+				scale_t scale, Level_Resolution level_resolution) const;
 
-			std::vector < Point > make_points(const std::filesystem::path & path) const;
+			std::vector < Point > make_points(const std::filesystem::path & path, scale_t scale) const;
 
-			Point parse(const std::string & line) const;
+			Point parse(const std::string & line, scale_t scale) const;
 
 			time_point_t parse(const Candle::date_t & date, const Candle::time_t & time) const;
 
@@ -322,16 +291,4 @@ namespace solution
 
 } // namespace solution
 
-BOOST_FUSION_ADAPT_STRUCT
-(
-	 solution::trader::Trader::Candle,
-	(solution::trader::Trader::Candle::date_t,   date)
-	(solution::trader::Trader::Candle::time_t,   time)
-	(solution::trader::Trader::Candle::price_t,  price_open)
-	(solution::trader::Trader::Candle::price_t,  price_high)
-	(solution::trader::Trader::Candle::price_t,  price_low)
-	(solution::trader::Trader::Candle::price_t,  price_close)
-	(solution::trader::Trader::Candle::volume_t, volume)
-)
-
 #endif // #ifndef SOLUTION_TRADER_TRADER_HPP
\ No newline at end of file